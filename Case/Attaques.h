@@ -0,0 +1,288 @@
+/*
+Attaques.h - Tables d'attaque precalculees pour toutes les pieces
+Les pieces qui sautent (cavalier, roi et pion) ont une table de 64 bitboards.
+Les pieces qui glissent (tour, fou et reine) utilisent des tables indexees par l'occupation
+de la rangee, de la colonne ou de la diagonale de la piece (methode "kindergarten").
+Une multiplication ramene les 6 cases interieures d'une ligne dans 6 bits, qui servent d'index.
+Les tables sont generees a la compilation (constexpr). Sur l'ESP32, les constantes sont placees
+dans la memoire flash (.rodata) et ne prennent aucune place en RAM.
+Chaque entree est un bitboard : le bit (rangee * 8 + colonne) est actif si la case est attaquee.
+Necessite C++17 (coeur ESP32 d'Arduino 3.0 ou plus recent)
+
+Taille en flash :
+  Cavalier, roi et pions        4 x 64 x 8 octets =   2 Ko
+  REMPLISSAGE (rangees, diag.)  8 x 64 x 8 octets =   4 Ko
+  ATTAQUES_COLONNE_A            8 x 64 x 8 octets =   4 Ko
+  MASQUE_DIAGONALE et ANTI.     2 x 64 x 8 octets =   1 Ko
+Total d'environ 11 Ko, contre environ 800 Ko pour des tables "magic" completes.
+*/
+
+#ifndef Attaques_h
+
+#define Attaques_h
+
+#include <stdint.h>
+
+// Structure. Un bitboard d'attaque pour chacune des 64 cases
+struct TableAttaques
+{
+  uint64_t cases[64];
+
+  constexpr uint64_t operator[](short position) const
+  {
+    return cases[position];
+  }
+};
+
+// Genere la table d'attaque d'une piece qui saute a partir de ses deplacements {rangee, colonne}
+// Les deplacements qui sortent de l'echiquier sont ignores
+constexpr TableAttaques genererSauts(const short (&deplacement)[8][2], short nombre)
+{
+  TableAttaques table = {};
+
+  for (short position = 0; position < 64; position++)
+  {
+    short rangee = position / 8;
+    short colonne = position % 8;
+
+    for (short i = 0; i < nombre; i++)
+    {
+      short newX = rangee + deplacement[i][0];
+      short newY = colonne + deplacement[i][1];
+
+      if (newX >= 0 && newX < 8 && newY >= 0 && newY < 8)
+      {
+        table.cases[position] |= 1ULL << (newX * 8 + newY);
+      }
+    }
+  }
+  return table;
+}
+
+// Deplacements possibles du cavalier {rangee, colonne}
+constexpr short DEPLACEMENT_CAVALIER[8][2] = {{-2, 1}, {-1, 2}, {1, 2}, {2, 1}, {2, -1}, {1, -2}, {-1, -2}, {-2, -1}};
+// Deplacements possibles du roi {rangee, colonne}
+constexpr short DEPLACEMENT_ROI[8][2] = {{1, 1}, {1, 0}, {1, -1}, {0, 1}, {0, -1}, {-1, 1}, {-1, 0}, {-1, -1}};
+// Captures du pion blanc, qui avance vers la rangee 7 {rangee, colonne}. Les deux dernieres entrees ne sont pas utilisees
+constexpr short CAPTURE_PION_BLANC[8][2] = {{1, -1}, {1, 1}};
+// Captures du pion noir, qui avance vers la rangee 0 {rangee, colonne}. Les deux dernieres entrees ne sont pas utilisees
+constexpr short CAPTURE_PION_NOIR[8][2] = {{-1, -1}, {-1, 1}};
+
+// Cases attaquees par un cavalier sur chaque case
+inline constexpr TableAttaques ATTAQUES_CAVALIER = genererSauts(DEPLACEMENT_CAVALIER, 8);
+// Cases attaquees par un roi sur chaque case
+inline constexpr TableAttaques ATTAQUES_ROI = genererSauts(DEPLACEMENT_ROI, 8);
+// Cases attaquees par un pion sur chaque case. [0] pour blanc, [1] pour noir
+// Astuce : une case est attaquee par un pion adverse si ATTAQUES_PION[joueur de la case] contient ce pion
+inline constexpr TableAttaques ATTAQUES_PION[2] = {genererSauts(CAPTURE_PION_BLANC, 2), genererSauts(CAPTURE_PION_NOIR, 2)};
+
+//****** Pieces qui glissent - Tour, fou et reine ******//
+
+// Colonne 0 au complet
+constexpr uint64_t COLONNE_A = 0x0101010101010101ULL;
+// Multiplicateur qui ramene les cases 1 a 6 de la colonne 0 dans les 6 bits du haut
+constexpr uint64_t MULT_COLONNE = 0x0080402010080400ULL;
+// Multiplicateur qui ramene les cases d'une diagonale dans les 6 bits du haut, une colonne par bit
+constexpr uint64_t MULT_DIAGONALE = 0x0202020202020202ULL;
+
+// Structure. Un bitboard d'attaque pour chaque colonne (ou rangee) et chacune des 64 occupations interieures
+struct TableLignes
+{
+  uint64_t lignes[8][64];
+};
+
+// Genere les attaques sur une rangee d'une piece en 'colonne', puis les copie sur les 8 rangees
+// Le bit i de 'occupation' indique si la colonne i + 1 est occupee
+constexpr TableLignes genererRemplissage()
+{
+  TableLignes table = {};
+
+  for (short colonne = 0; colonne < 8; colonne++)
+  {
+    for (short occupation = 0; occupation < 64; occupation++)
+    {
+      uint64_t rangee = 0;
+
+      // Vers la droite, puis vers la gauche. Arrete sur la premiere piece rencontree
+      for (short newY = colonne + 1; newY < 8; newY++)
+      {
+        rangee |= 1ULL << newY;
+        if (newY < 7 && (occupation >> (newY - 1)) & 1)
+        {
+          break;
+        }
+      }
+      for (short newY = colonne - 1; newY >= 0; newY--)
+      {
+        rangee |= 1ULL << newY;
+        if (newY > 0 && (occupation >> (newY - 1)) & 1)
+        {
+          break;
+        }
+      }
+      table.lignes[colonne][occupation] = rangee * COLONNE_A;
+    }
+  }
+  return table;
+}
+
+// Genere les attaques d'une piece sur la colonne 0 pour chaque rangee
+// L'index est calcule avec MULT_COLONNE a partir de chacune des 64 occupations possibles des cases 1 a 6
+constexpr TableLignes genererColonneA()
+{
+  TableLignes table = {};
+
+  for (short rangee = 0; rangee < 8; rangee++)
+  {
+    for (short sousEnsemble = 0; sousEnsemble < 64; sousEnsemble++)
+    {
+      uint64_t occupation = 0;
+      uint64_t colonne = 0;
+
+      for (short i = 0; i < 6; i++)
+      {
+        if ((sousEnsemble >> i) & 1)
+        {
+          occupation |= 1ULL << ((i + 1) * 8);
+        }
+      }
+
+      // Vers le haut, puis vers le bas. Arrete sur la premiere piece rencontree
+      for (short newX = rangee + 1; newX < 8; newX++)
+      {
+        colonne |= 1ULL << (newX * 8);
+        if (occupation & (1ULL << (newX * 8)))
+        {
+          break;
+        }
+      }
+      for (short newX = rangee - 1; newX >= 0; newX--)
+      {
+        colonne |= 1ULL << (newX * 8);
+        if (occupation & (1ULL << (newX * 8)))
+        {
+          break;
+        }
+      }
+      table.lignes[rangee][(occupation * MULT_COLONNE) >> 58] = colonne;
+    }
+  }
+  return table;
+}
+
+// Genere le masque d'une diagonale pour chaque case, sans la case elle-meme
+// direction = 1 pour la diagonale (rangee et colonne augmentent ensemble), -1 pour l'antidiagonale
+constexpr TableAttaques genererDiagonales(short direction)
+{
+  TableAttaques table = {};
+
+  for (short position = 0; position < 64; position++)
+  {
+    short rangee = position / 8;
+    short colonne = position % 8;
+
+    for (short i = -7; i <= 7; i++)
+    {
+      short newX = rangee + i;
+      short newY = colonne + direction * i;
+
+      if (i != 0 && newX >= 0 && newX < 8 && newY >= 0 && newY < 8)
+      {
+        table.cases[position] |= 1ULL << (newX * 8 + newY);
+      }
+    }
+  }
+  return table;
+}
+
+// Attaques sur une rangee pour chaque colonne, copiees sur toutes les rangees
+inline constexpr TableLignes REMPLISSAGE = genererRemplissage();
+// Attaques sur la colonne 0 pour chaque rangee
+inline constexpr TableLignes ATTAQUES_COLONNE_A = genererColonneA();
+// Diagonale de chaque case, sans la case
+inline constexpr TableAttaques MASQUE_DIAGONALE = genererDiagonales(1);
+// Antidiagonale de chaque case, sans la case
+inline constexpr TableAttaques MASQUE_ANTIDIAGONALE = genererDiagonales(-1);
+
+// Retourne les cases attaquees sur la rangee de 'position'
+inline uint64_t attaquesRangee(short position, uint64_t occupation)
+{
+  short rangee = position / 8;
+  uint64_t interieur = (occupation >> (rangee * 8 + 1)) & 63;
+
+  return REMPLISSAGE.lignes[position % 8][interieur] & (0xFFULL << (rangee * 8));
+}
+
+// Retourne les cases attaquees sur la colonne de 'position'
+inline uint64_t attaquesColonne(short position, uint64_t occupation)
+{
+  short colonne = position % 8;
+  uint64_t interieur = ((COLONNE_A & (occupation >> colonne)) * MULT_COLONNE) >> 58;
+
+  return ATTAQUES_COLONNE_A.lignes[position / 8][interieur] << colonne;
+}
+
+// Retourne les cases attaquees sur une diagonale donnee par son masque
+inline uint64_t attaquesDiagonale(short position, uint64_t occupation, uint64_t masque)
+{
+  uint64_t interieur = ((masque & occupation) * MULT_DIAGONALE) >> 58;
+
+  return REMPLISSAGE.lignes[position % 8][interieur] & masque;
+}
+
+// Retourne les cases attaquees par une tour sur 'position'
+// occupation : toutes les cases occupees de l'echiquier. Les pieces bloquent la tour mais la case bloquee est attaquee
+inline uint64_t attaquesTour(short position, uint64_t occupation)
+{
+  return attaquesRangee(position, occupation) | attaquesColonne(position, occupation);
+}
+
+// Retourne les cases attaquees par un fou sur 'position'
+inline uint64_t attaquesFou(short position, uint64_t occupation)
+{
+  return attaquesDiagonale(position, occupation, MASQUE_DIAGONALE[position]) |
+         attaquesDiagonale(position, occupation, MASQUE_ANTIDIAGONALE[position]);
+}
+
+// Retourne les cases attaquees par une reine sur 'position'. C'est l'union de la tour et du fou
+inline uint64_t attaquesReine(short position, uint64_t occupation)
+{
+  return attaquesTour(position, occupation) | attaquesFou(position, occupation);
+}
+
+// Retourne les cases strictement entre deux cases alignees, ou 0 si elles ne sont pas alignees
+// Chaque case regarde l'autre comme une tour (ou un fou) bloquee par l'autre case : les rayons se croisent entre les deux
+inline uint64_t entre(short depart, short arrivee)
+{
+  uint64_t bitDepart = 1ULL << depart;
+  uint64_t bitArrivee = 1ULL << arrivee;
+
+  if (attaquesTour(depart, 0) & bitArrivee)
+  {
+    return attaquesTour(depart, bitArrivee) & attaquesTour(arrivee, bitDepart);
+  }
+  if (attaquesFou(depart, 0) & bitArrivee)
+  {
+    return attaquesFou(depart, bitArrivee) & attaquesFou(arrivee, bitDepart);
+  }
+  return 0;
+}
+
+// Retourne la ligne complete (rangee, colonne ou diagonale) qui passe par deux cases, ou 0 si elles ne sont pas alignees
+// Sert a limiter une piece clouee a la ligne entre son roi et la piece qui la cloue
+inline uint64_t ligne(short depart, short arrivee)
+{
+  uint64_t extremites = (1ULL << depart) | (1ULL << arrivee);
+
+  if (attaquesTour(depart, 0) & (1ULL << arrivee))
+  {
+    return (attaquesTour(depart, 0) & attaquesTour(arrivee, 0)) | extremites;
+  }
+  if (attaquesFou(depart, 0) & (1ULL << arrivee))
+  {
+    return (attaquesFou(depart, 0) & attaquesFou(arrivee, 0)) | extremites;
+  }
+  return 0;
+}
+
+#endif
@@ -0,0 +1,751 @@
+#include <Board.h>
+#include <Attaques.h>
+#include <Zobrist.h>
+#include <string.h>
+
+// Symbole de chaque type de piece en notation anglaise, dans l'ordre de TypePiece
+static const char SYMBOLES[] = {'P', 'N', 'B', 'R', 'Q', 'K'};
+
+// Structure. Cases d'un roque sur la rangee 0. Decaler de (rangee * 8) pour la rangee du joueur
+struct Roque
+{
+  short tour;        // Colonne de depart de la tour
+  short roi;         // Colonne d'arrivee du roi
+  short tourArrivee; // Colonne d'arrivee de la tour
+  uint64_t vides;    // Cases qui doivent etre vides entre le roi et la tour
+  uint64_t passage;  // Cases traversees par le roi, qui ne doivent pas etre attaquees
+};
+
+// [0] petit roque vers la colonne 0, [1] grand roque vers la colonne 7
+static const Roque ROQUES[2] = {
+    {0, 1, 2, 0x06, 0x06},
+    {7, 5, 4, 0x70, 0x30}};
+
+#define CASES_ROQUE 0x8900000000000089ULL // Cases de depart des rois et des tours : seules a changer les droits de roque
+
+// Retourne la part d'un octet de case dans la cle de hachage. Les droits de roque sont haches a part (voir ecrire)
+static uint64_t cleOctet(short position, uint8_t octet)
+{
+  uint64_t cle = 0;
+  short type = (octet & OCTET_TYPE) - 1;
+
+  if (type >= 0 && (octet & OCTET_BLANC))
+  {
+    cle ^= ZOBRIST.pieces[type][position];
+  }
+  else if (type >= 0 && (octet & OCTET_NOIR))
+  {
+    cle ^= ZOBRIST.pieces[AUCUNE + type][position];
+  }
+  if (octet & OCTET_VULNERABLE)
+  {
+    cle ^= ZOBRIST.passant[position % TAILLE];
+  }
+  return cle;
+}
+
+// Ajoute un coup vers chaque case d'un masque a la liste. Retourne le nouveau nombre de coups
+// Les arrivees sur une piece adverse sont marquees comme des captures
+static int ajouterCoups(Coup *liste, int nombre, short depart, uint64_t arrivees, uint64_t adverses)
+{
+  while (arrivees)
+  {
+    short arrivee = extraireCase(arrivees);
+
+    liste[nombre++] = creerCoup(depart, arrivee, (adverses & bitCase(arrivee)) ? COUP_CAPTURE : COUP_NORMAL);
+  }
+  return nombre;
+}
+
+// Ajoute les coups d'un pion vers chaque case d'un masque. Une arrivee sur la derniere rangee
+// donne quatre coups, un par piece de promotion, en commencant par la reine
+static int ajouterCoupsPion(Coup *liste, int nombre, short depart, uint64_t arrivees, uint64_t adverses, uint8_t drapeaux)
+{
+  while (arrivees)
+  {
+    short arrivee = extraireCase(arrivees);
+    uint8_t capture = (adverses & bitCase(arrivee)) ? COUP_CAPTURE : COUP_NORMAL;
+
+    if (arrivee / TAILLE == 0 || arrivee / TAILLE == TAILLE - 1)
+    {
+      for (short piece = 3; piece >= 0; piece--)
+      {
+        liste[nombre++] = creerCoup(depart, arrivee, COUP_PROMOTION | capture | piece);
+      }
+    }
+    else
+    {
+      liste[nombre++] = creerCoup(depart, arrivee, drapeaux | capture);
+    }
+  }
+  return nombre;
+}
+
+// Constructeur. Creer un echiquier vide
+Board::Board()
+{
+  vider();
+}
+
+// Retire toutes les pieces et tous les indicateurs de l'echiquier
+void Board::vider()
+{
+  memset(_cases, 0, sizeof(_cases));
+  _joueurs[0] = 0;
+  _joueurs[1] = 0;
+  for (short i = 0; i < AUCUNE; i++)
+  {
+    _pieces[i] = 0;
+  }
+  _aBouger = 0;
+  _vulnerable = 0;
+  _cle = 0;
+  _trait = 1;
+}
+
+// Retourne une copie compacte de l'echiquier, un octet par case
+Instantane Board::instantane() const
+{
+  Instantane copie;
+
+  memcpy(copie.cases, _cases, sizeof(_cases));
+  return copie;
+}
+
+// Remplace l'echiquier par une copie compacte. Les bitboards et la cle sont reconstruits
+// Le trait n'est pas dans la copie et reste inchange
+void Board::restaurer(const Instantane &copie)
+{
+  short trait = _trait;
+
+  vider();
+  setTrait(trait);
+  for (short position = 0; position < 64; position++)
+  {
+    ecrire(position, copie.cases[position]);
+  }
+}
+
+// Retourne l'octet brut d'une case. Voir OCTET_...
+uint8_t Board::getOctet(short position) const
+{
+  return _cases[position];
+}
+
+// Retourne le joueur qui doit jouer. 1 pour blanc, -1 pour noir
+short Board::getTrait() const
+{
+  return _trait;
+}
+
+// Donne le trait a un joueur. 1 pour blanc, -1 pour noir
+void Board::setTrait(short joueur)
+{
+  joueur = (joueur < 0) ? -1 : 1;
+  if (joueur != _trait)
+  {
+    _cle ^= ZOBRIST.trait;
+    _trait = joueur;
+  }
+}
+
+// Retourne la cle de hachage Zobrist de la position, tenue a jour a chaque modification
+// Deux positions identiques (pieces, trait, droits de roque et prise en passant) ont la meme cle
+uint64_t Board::cle() const
+{
+  return _cle;
+}
+
+// Recalcule la cle de hachage a partir des 64 cases. Sert a verifier la mise a jour incrementale
+uint64_t Board::calculerCle() const
+{
+  uint64_t cle = ((_trait < 0) ? ZOBRIST.trait : 0) ^ ZOBRIST.roque[droitsRoque()];
+
+  for (short position = 0; position < 64; position++)
+  {
+    cle ^= cleOctet(position, _cases[position]);
+  }
+  return cle;
+}
+
+//****** Modifications - Mise a jour incrementale des bitboards ******//
+
+// Place une piece d'un joueur sur une case. La piece qui s'y trouvait est remplacee
+// piece : lettre de la piece en notation anglaise (R, N, B, Q, K, P)
+// joueur : 1 pour blanc, -1 pour noir
+void Board::placer(short position, char piece, short joueur)
+{
+  short type = typePiece(piece);
+  uint8_t octet = _cases[position] & (OCTET_A_BOUGER | OCTET_VULNERABLE);
+
+  if (type != AUCUNE)
+  {
+    octet |= type + 1;
+  }
+  if (joueur > 0)
+  {
+    octet |= OCTET_BLANC;
+  }
+  else if (joueur < 0)
+  {
+    octet |= OCTET_NOIR;
+  }
+  ecrire(position, octet);
+}
+
+// Retire la piece d'une case. Les indicateurs de la case sont conserves
+void Board::retirer(short position)
+{
+  ecrire(position, _cases[position] & (OCTET_A_BOUGER | OCTET_VULNERABLE));
+}
+
+// Deplace la piece d'une case vers une autre. Une piece sur la case d'arrivee est capturee
+// Les deux cases sont marquees comme modifiees par un deplacement
+void Board::deplacer(short depart, short arrivee)
+{
+  uint8_t piece = _cases[depart] & (OCTET_TYPE | OCTET_BLANC | OCTET_NOIR);
+
+  ecrire(depart, (_cases[depart] & OCTET_VULNERABLE) | OCTET_A_BOUGER);
+  ecrire(arrivee, (_cases[arrivee] & OCTET_VULNERABLE) | OCTET_A_BOUGER | piece);
+}
+
+// Remplace l'octet d'une case et met a jour les bitboards et la cle de hachage
+// Seuls les bits de cette case sont touches, peu importe le nombre de pieces sur l'echiquier
+// Sur une case de depart d'un roi ou d'une tour, les droits de roque sont retires de la cle avant, et remis apres
+void Board::ecrire(short position, uint8_t octet)
+{
+  bool roque = (bitCase(position) & CASES_ROQUE) != 0;
+
+  if (roque)
+  {
+    _cle ^= ZOBRIST.roque[droitsRoque()];
+  }
+  _cle ^= cleOctet(position, _cases[position]) ^ cleOctet(position, octet);
+  basculer(position, _cases[position]);
+  _cases[position] = octet;
+  basculer(position, octet);
+  if (roque)
+  {
+    _cle ^= ZOBRIST.roque[droitsRoque()];
+  }
+}
+
+// Retourne les droits de roque, un bit par roque : blancs vers la colonne 0, blancs vers la colonne 7, puis les noirs
+// Un droit demande le roi et la tour du joueur sur leurs cases de depart, sans marque de deplacement
+uint8_t Board::droitsRoque() const
+{
+  uint8_t droits = 0;
+
+  for (short joueur = 0; joueur < 2; joueur++)
+  {
+    short rangee = joueur ? TAILLE - 1 : 0;
+    uint64_t immobiles = _joueurs[joueur] & ~_aBouger;
+
+    if (!(immobiles & _pieces[ROI] & bitCase(numeroCase(rangee, COLONNE_ROI))))
+    {
+      continue;
+    }
+    for (short i = 0; i < 2; i++)
+    {
+      if (immobiles & _pieces[TOUR] & bitCase(numeroCase(rangee, ROQUES[i].tour)))
+      {
+        droits |= 1 << (joueur * 2 + i);
+      }
+    }
+  }
+  return droits;
+}
+
+// Inverse le bit de la case dans chaque bitboard qui correspond a l'octet
+// Appele une fois avec l'ancien octet pour le retirer, puis avec le nouveau pour l'ajouter
+void Board::basculer(short position, uint8_t octet)
+{
+  uint64_t masque = bitCase(position);
+
+  if (octet & OCTET_TYPE)
+  {
+    _pieces[(octet & OCTET_TYPE) - 1] ^= masque;
+  }
+  if (octet & OCTET_BLANC)
+  {
+    _joueurs[0] ^= masque;
+  }
+  if (octet & OCTET_NOIR)
+  {
+    _joueurs[1] ^= masque;
+  }
+  if (octet & OCTET_A_BOUGER)
+  {
+    _aBouger ^= masque;
+  }
+  if (octet & OCTET_VULNERABLE)
+  {
+    _vulnerable ^= masque;
+  }
+}
+
+//****** Getters et setters par case ******//
+
+// Retourne la piece sur une case en notation anglaise ou ' ' si aucune piece
+char Board::getPiece(short position) const
+{
+  return symbolePiece((_cases[position] & OCTET_TYPE) - 1);
+}
+
+// Change le type de piece d'une case sans toucher au joueur
+// Un symbole inconnu ou ' ' retire le type de piece de la case
+void Board::setPiece(short position, char piece)
+{
+  short type = typePiece(piece);
+  uint8_t octet = _cases[position] & ~OCTET_TYPE;
+
+  if (type != AUCUNE)
+  {
+    octet |= type + 1;
+  }
+  ecrire(position, octet);
+}
+
+// Retourne le joueur sur une case. 1 pour blanc, -1 pour noir ou 0 si aucun joueur
+short Board::getJoueur(short position) const
+{
+  if (_cases[position] & OCTET_BLANC)
+  {
+    return 1;
+  }
+  if (_cases[position] & OCTET_NOIR)
+  {
+    return -1;
+  }
+  return 0;
+}
+
+// Change le joueur d'une case sans toucher au type de piece
+// 1 pour blanc, -1 pour noir ou 0 si aucun joueur
+void Board::setJoueur(short position, short joueur)
+{
+  uint8_t octet = _cases[position] & ~(OCTET_BLANC | OCTET_NOIR);
+
+  if (joueur > 0)
+  {
+    octet |= OCTET_BLANC;
+  }
+  else if (joueur < 0)
+  {
+    octet |= OCTET_NOIR;
+  }
+  ecrire(position, octet);
+}
+
+// Retourne si une piece a bouge ou non sur cette case
+bool Board::getABouger(short position) const
+{
+  return _cases[position] & OCTET_A_BOUGER;
+}
+
+// Indique qu'une piece a bouge sur cette case. Cet etat ne peut que devenir vrai
+void Board::setABouger(short position)
+{
+  ecrire(position, _cases[position] | OCTET_A_BOUGER);
+}
+
+// Retourne si la case est vulnerable a une prise en passant
+bool Board::getVulnerable(short position) const
+{
+  return _cases[position] & OCTET_VULNERABLE;
+}
+
+// Assigne un etat de vulnerabilite a une prise en passant
+void Board::setVulnerable(short position, bool vulnerable)
+{
+  if (vulnerable)
+  {
+    ecrire(position, _cases[position] | OCTET_VULNERABLE);
+  }
+  else
+  {
+    ecrire(position, _cases[position] & ~OCTET_VULNERABLE);
+  }
+}
+
+// Verifie si une case est vide. Ie. si aucun joueur n'y a de piece
+bool Board::isVide(short position) const
+{
+  return !(occupation() & bitCase(position));
+}
+
+//****** Bitboards - Ensembles de cases en O(1) ******//
+
+// Retourne les cases occupees, peu importe le joueur.
+// Meme format que le mot 'tableau' lu par les senseurs
+uint64_t Board::occupation() const
+{
+  return _joueurs[0] | _joueurs[1];
+}
+
+// Retourne les cases occupees par un joueur. 1 pour blanc, -1 pour noir
+uint64_t Board::pieces(short joueur) const
+{
+  return _joueurs[indexJoueur(joueur)];
+}
+
+// Retourne les cases occupees par un type de piece d'un joueur
+uint64_t Board::pieces(char piece, short joueur) const
+{
+  short type = typePiece(piece);
+
+  if (type == AUCUNE)
+  {
+    return 0;
+  }
+  return _pieces[type] & _joueurs[indexJoueur(joueur)];
+}
+
+// Retourne les cases vulnerables a une prise en passant
+uint64_t Board::vulnerables() const
+{
+  return _vulnerable;
+}
+
+//****** Coups legaux - Echecs et clouages calcules une seule fois par position ******//
+
+// Retourne la case du roi d'un joueur ou -1 s'il n'est pas sur l'echiquier
+short Board::roi(short joueur) const
+{
+  uint64_t rois = _pieces[ROI] & _joueurs[indexJoueur(joueur)];
+
+  if (!rois)
+  {
+    return -1;
+  }
+  return __builtin_ctzll(rois);
+}
+
+// Retourne les pieces d'un joueur qui attaquent une case
+// occupation : cases qui bloquent les pieces qui glissent. Permet de retirer une piece qui se deplace
+uint64_t Board::attaquants(short position, short joueur, uint64_t occupation) const
+{
+  uint64_t droites = _pieces[TOUR] | _pieces[REINE];
+  uint64_t diagonales = _pieces[FOU] | _pieces[REINE];
+
+  // Un pion attaque la case si un pion de l'autre joueur sur la case attaquerait ce pion
+  return ((ATTAQUES_PION[indexJoueur(-joueur)][position] & _pieces[PION]) |
+          (ATTAQUES_CAVALIER[position] & _pieces[CAVALIER]) |
+          (ATTAQUES_ROI[position] & _pieces[ROI]) |
+          (attaquesTour(position, occupation) & droites) |
+          (attaquesFou(position, occupation) & diagonales)) &
+         _joueurs[indexJoueur(joueur)];
+}
+
+// Retourne les pieces adverses qui mettent le roi d'un joueur en echec
+uint64_t Board::echecs(short joueur) const
+{
+  short position = roi(joueur);
+
+  if (position < 0)
+  {
+    return 0;
+  }
+  return attaquants(position, -joueur, occupation());
+}
+
+// Retourne les pieces d'un joueur clouees sur leur roi
+// Une piece est clouee si elle est la seule piece entre son roi et une tour, un fou ou une reine adverse
+uint64_t Board::cloues(short joueur) const
+{
+  short position = roi(joueur);
+  uint64_t amis = _joueurs[indexJoueur(joueur)];
+  uint64_t adverses = _joueurs[indexJoueur(-joueur)];
+  uint64_t cloueurs;
+  uint64_t resultat = 0;
+
+  if (position < 0)
+  {
+    return 0;
+  }
+
+  // On regarde depuis le roi a travers ses propres pieces : seules les pieces adverses bloquent les rayons
+  cloueurs = ((attaquesTour(position, adverses) & (_pieces[TOUR] | _pieces[REINE])) |
+              (attaquesFou(position, adverses) & (_pieces[FOU] | _pieces[REINE]))) &
+             adverses;
+
+  while (cloueurs)
+  {
+    uint64_t bloqueurs = entre(position, extraireCase(cloueurs)) & occupation();
+
+    // Un seul bloqueur, et c'est une piece du joueur
+    if (bloqueurs && !(bloqueurs & (bloqueurs - 1)) && (bloqueurs & amis))
+    {
+      resultat |= bloqueurs;
+    }
+  }
+  return resultat;
+}
+
+// Remplit 'liste' avec les coups legaux d'un joueur et retourne le nombre de coups
+// departs : cases dont on veut les coups. Par defaut, toutes les pieces du joueur
+// La liste doit pouvoir contenir MAX_COUPS coups (MAX_COUPS_PIECE pour une seule piece)
+// Les echecs et les clouages sont calcules une seule fois. Chaque piece est ensuite filtree par des masques :
+//   - en echec simple, les autres pieces doivent capturer la piece qui donne echec ou s'interposer
+//   - en echec double, seul le roi peut bouger
+//   - une piece clouee reste sur la ligne entre son roi et la piece qui la cloue
+// Seuls le roi et la prise en passant demandent un test d'attaque par coup
+int Board::genererCoups(short joueur, Coup *liste, uint64_t departs) const
+{
+  int nombre = 0;
+  short index = indexJoueur(joueur);
+  short positionRoi = roi(joueur);
+  uint64_t occupe = occupation();
+  uint64_t amis = _joueurs[index];
+  uint64_t adverses = _joueurs[indexJoueur(-joueur)];
+  uint64_t echec;
+  uint64_t cloue;
+  uint64_t cible; // Cases d'arrivee permises aux pieces autres que le roi
+  uint64_t masque;
+
+  if (positionRoi < 0)
+  {
+    return 0;
+  }
+
+  echec = echecs(joueur);
+  cloue = cloues(joueur);
+
+  // Roi : chaque case est testee sans le roi dans l'occupation, sinon il cacherait la case derriere lui
+  if (departs & bitCase(positionRoi))
+  {
+    masque = ATTAQUES_ROI[positionRoi] & ~amis;
+    while (masque)
+    {
+      short arrivee = extraireCase(masque);
+
+      if (!attaquants(arrivee, -joueur, occupe ^ bitCase(positionRoi)))
+      {
+        nombre = ajouterCoups(liste, nombre, positionRoi, bitCase(arrivee), adverses);
+      }
+    }
+
+    // Roques : le roi et la tour n'ont jamais bouge, le chemin est vide et le roi ne traverse aucune case attaquee
+    short rangee = (joueur > 0) ? 0 : TAILLE - 1;
+    short maison = numeroCase(rangee, COLONNE_ROI);
+
+    if (!echec && positionRoi == maison && !(_aBouger & bitCase(maison)))
+    {
+      for (short i = 0; i < 2; i++)
+      {
+        short tour = numeroCase(rangee, ROQUES[i].tour);
+        uint64_t passage = ROQUES[i].passage << (rangee * TAILLE);
+        bool libre = (amis & _pieces[TOUR] & bitCase(tour)) && !(_aBouger & bitCase(tour)) &&
+                     !(occupe & (ROQUES[i].vides << (rangee * TAILLE)));
+
+        while (libre && passage)
+        {
+          libre = !attaquants(extraireCase(passage), -joueur, occupe);
+        }
+        if (libre)
+        {
+          liste[nombre++] = creerCoup(maison, numeroCase(rangee, ROQUES[i].roi), COUP_PETIT_ROQUE + i);
+        }
+      }
+    }
+  }
+
+  // Echec double : seul le roi peut bouger
+  if (echec & (echec - 1))
+  {
+    return nombre;
+  }
+
+  // Echec simple : capturer la piece ou s'interposer
+  cible = ~amis;
+  if (echec)
+  {
+    cible &= echec | entre(positionRoi, __builtin_ctzll(echec));
+  }
+
+  // Cavaliers, fous, tours et reines
+  masque = amis & ~(_pieces[PION] | _pieces[ROI]) & departs;
+  while (masque)
+  {
+    short depart = extraireCase(masque);
+    uint64_t arrivees;
+
+    switch ((_cases[depart] & OCTET_TYPE) - 1)
+    {
+    case CAVALIER:
+      arrivees = ATTAQUES_CAVALIER[depart];
+      break;
+    case FOU:
+      arrivees = attaquesFou(depart, occupe);
+      break;
+    case TOUR:
+      arrivees = attaquesTour(depart, occupe);
+      break;
+    default:
+      arrivees = attaquesReine(depart, occupe);
+      break;
+    }
+
+    arrivees &= cible;
+    if (cloue & bitCase(depart))
+    {
+      arrivees &= ligne(positionRoi, depart);
+    }
+    nombre = ajouterCoups(liste, nombre, depart, arrivees, adverses);
+  }
+
+  // Pions. Le joueur blanc avance vers la rangee 7 et le joueur noir vers la rangee 0
+  masque = amis & _pieces[PION] & departs;
+  while (masque)
+  {
+    short depart = extraireCase(masque);
+    short avant = depart + joueur * TAILLE;
+    uint64_t limite = cible;
+    uint64_t passant;
+
+    if (cloue & bitCase(depart))
+    {
+      limite &= ligne(positionRoi, depart);
+    }
+
+    // Avancer d'une case, puis de deux cases depuis la rangee de depart
+    if (!(occupe & bitCase(avant)))
+    {
+      nombre = ajouterCoupsPion(liste, nombre, depart, bitCase(avant) & limite, adverses, COUP_NORMAL);
+
+      short rangeeDepart = (joueur > 0) ? 1 : TAILLE - 2;
+      short deuxCases = avant + joueur * TAILLE;
+
+      if (depart / TAILLE == rangeeDepart && !(occupe & bitCase(deuxCases)) && (limite & bitCase(deuxCases)))
+      {
+        liste[nombre++] = creerCoup(depart, deuxCases, COUP_DOUBLE);
+      }
+    }
+
+    // Captures
+    nombre = ajouterCoupsPion(liste, nombre, depart, ATTAQUES_PION[index][depart] & adverses & limite, adverses, COUP_CAPTURE);
+
+    // Prise en passant. Le pion capture est a cote du pion, pas sur la case d'arrivee.
+    // On simule le coup : il est legal si aucune tour, fou ou reine ne voit le roi apres le retrait des deux pions,
+    // et si la seule piece qui donnait echec etait le pion capture. Couvre le clouage horizontal sur la rangee
+    passant = ATTAQUES_PION[index][depart] & _vulnerable & ~occupe;
+    if (passant)
+    {
+      short arrivee = __builtin_ctzll(passant);
+      short prise = numeroCase(depart / TAILLE, arrivee % TAILLE);
+      uint64_t apres = (occupe ^ bitCase(depart) ^ bitCase(prise)) | bitCase(arrivee);
+
+      if ((adverses & _pieces[PION] & bitCase(prise)) && !(attaquants(positionRoi, -joueur, apres) & ~bitCase(prise)))
+      {
+        liste[nombre++] = creerCoup(depart, arrivee, COUP_EN_PASSANT);
+      }
+    }
+  }
+
+  return nombre;
+}
+
+// Retourne le coup legal d'un joueur entre deux cases, ou COUP_NUL si aucun coup ne correspond
+// Une promotion donne une reine
+Coup Board::trouverCoup(short joueur, short depart, short arrivee) const
+{
+  Coup coups[MAX_COUPS_PIECE];
+  int nombre = genererCoups(joueur, coups, bitCase(depart));
+
+  for (int i = 0; i < nombre; i++)
+  {
+    if (arriveeCoup(coups[i]) == arrivee)
+    {
+      return coups[i];
+    }
+  }
+  return COUP_NUL;
+}
+
+// Joue un coup sur l'echiquier : capture, roque, prise en passant et promotion
+// Les vulnerabilites a la prise en passant du coup precedent sont retirees et le trait passe a l'adversaire du joueur qui a joue
+void Board::jouer(Coup coup)
+{
+  short depart = departCoup(coup);
+  short arrivee = arriveeCoup(coup);
+  uint8_t drapeaux = drapeauxCoup(coup);
+  uint64_t vulnerable = _vulnerable;
+
+  while (vulnerable)
+  {
+    setVulnerable(extraireCase(vulnerable), false);
+  }
+
+  if (drapeaux == COUP_EN_PASSANT)
+  {
+    retirer(numeroCase(depart / TAILLE, arrivee % TAILLE));
+  }
+
+  deplacer(depart, arrivee);
+
+  if (drapeaux == COUP_DOUBLE)
+  {
+    // La case sautee par le pion devient vulnerable a une prise en passant
+    setVulnerable((depart + arrivee) / 2, true);
+  }
+  else if (estRoque(coup))
+  {
+    short tourDepart, tourArrivee;
+
+    tourRoque(coup, tourDepart, tourArrivee);
+    deplacer(tourDepart, tourArrivee);
+  }
+  else if (estPromotion(coup))
+  {
+    setPiece(arrivee, symbolePiece(promotionCoup(coup)));
+  }
+
+  setTrait(-getJoueur(arrivee));
+}
+
+// Donne la case de depart et d'arrivee de la tour pour un coup de roque
+void Board::tourRoque(Coup coup, short &depart, short &arrivee)
+{
+  short rangee = departCoup(coup) / TAILLE;
+  const Roque &roque = ROQUES[drapeauxCoup(coup) - COUP_PETIT_ROQUE];
+
+  depart = numeroCase(rangee, roque.tour);
+  arrivee = numeroCase(rangee, roque.tourArrivee);
+}
+
+//****** Fonctions utilitaires ******//
+
+// Convertit une lettre de piece (majuscule ou minuscule) en index de TypePiece
+// Retourne AUCUNE si la lettre ne correspond a aucune piece
+short Board::typePiece(char piece)
+{
+  if (piece >= 'a' && piece <= 'z')
+  {
+    piece = piece + 'A' - 'a';
+  }
+
+  for (short type = 0; type < AUCUNE; type++)
+  {
+    if (SYMBOLES[type] == piece)
+    {
+      return type;
+    }
+  }
+  return AUCUNE;
+}
+
+// Convertit un index de TypePiece en lettre de piece. ' ' si aucune piece
+char Board::symbolePiece(short type)
+{
+  if (type < 0 || type >= AUCUNE)
+  {
+    return ' ';
+  }
+  return SYMBOLES[type];
+}
+
+// Convertit un joueur (1 ou -1) en index de _joueurs et des tables d'attaque
+short Board::indexJoueur(short joueur)
+{
+  return joueur > 0 ? 0 : 1;
+}
@@ -0,0 +1,140 @@
+/*
+Board.h - Representation de l'echiquier par octets et par bitboards
+Chaque case est un octet qui contient le type de piece, le joueur et les indicateurs de la case.
+Les 64 octets forment la source de verite de la partie et une copie compacte de l'echiquier.
+Chaque bitboard est un mot de 64 bits ou le bit (rangee * 8 + colonne) represente une case.
+C'est la meme convention que le mot 'tableau' lu par les senseurs, ce qui permet de les comparer directement.
+Les bitboards et la cle de hachage (Zobrist.h) sont mis a jour de facon incrementale a chaque ecriture d'un octet.
+Les objets Case ne sont qu'une vue sur une case de Board.
+*/
+
+#ifndef Board_h
+
+#define Board_h
+
+#include <stdint.h>
+#include <Coup.h>
+
+#ifndef TAILLE
+#define TAILLE 8 // Taille de la grille. 8x8 aux echecs
+#endif
+
+// Index des types de piece dans les bitboards
+enum TypePiece
+{
+  PION,
+  CAVALIER,
+  FOU,
+  TOUR,
+  REINE,
+  ROI,
+  AUCUNE // Aucun type de piece. Doit rester le dernier
+};
+
+// Format de l'octet d'une case
+#define OCTET_TYPE 0x07       // Bits 0 a 2 : type de piece + 1 (voir TypePiece). 0 si aucune piece
+#define OCTET_BLANC 0x08      // Bit 3 : piece du joueur blanc
+#define OCTET_NOIR 0x10       // Bit 4 : piece du joueur noir
+#define OCTET_A_BOUGER 0x20   // Bit 5 : case modifiee par le deplacement d'une piece
+#define OCTET_VULNERABLE 0x40 // Bit 6 : case vulnerable a une prise en passant
+
+// Roque. Le roi commence sur la colonne 3 et les tours sur les colonnes 0 et 7 (voir initialiseGrille)
+#define COLONNE_ROI 3 // Colonne de depart du roi
+
+// Structure. Copie compacte de l'echiquier, un octet par case
+// Permet de sauvegarder et de restaurer une position a peu de frais
+struct Instantane
+{
+  uint8_t cases[64];
+};
+
+// Retourne le numero (0 a 63) d'une case a partir de sa rangee et de sa colonne
+inline short numeroCase(short rangee, short colonne)
+{
+  return rangee * TAILLE + colonne;
+}
+
+// Retourne un bitboard dont seul le bit de la case est actif
+inline uint64_t bitCase(short position)
+{
+  return 1ULL << position;
+}
+
+// Retourne le numero de la plus petite case active d'un bitboard et la retire du bitboard
+// Le bitboard ne doit pas etre vide. Permet de parcourir un masque sans tester les 64 cases
+inline short extraireCase(uint64_t &bitboard)
+{
+  short position = __builtin_ctzll(bitboard);
+  bitboard &= bitboard - 1;
+  return position;
+}
+
+// Objet. Contient la position de toutes les pieces sous forme d'octets et de bitboards
+class Board
+{
+public:
+  Board();
+
+  void vider();
+  Instantane instantane() const;
+  void restaurer(const Instantane &copie);
+  uint8_t getOctet(short position) const;
+
+  short getTrait() const;
+  void setTrait(short joueur);
+  uint64_t cle() const;
+  uint64_t calculerCle() const;
+
+  void placer(short position, char piece, short joueur);
+  void retirer(short position);
+  void deplacer(short depart, short arrivee);
+
+  char getPiece(short position) const;
+  void setPiece(short position, char piece);
+
+  short getJoueur(short position) const;
+  void setJoueur(short position, short joueur);
+
+  bool getABouger(short position) const;
+  void setABouger(short position);
+
+  bool getVulnerable(short position) const;
+  void setVulnerable(short position, bool vulnerable);
+
+  bool isVide(short position) const;
+
+  uint64_t occupation() const;
+  uint64_t pieces(short joueur) const;
+  uint64_t pieces(char piece, short joueur) const;
+  uint64_t vulnerables() const;
+
+  short roi(short joueur) const;
+  uint64_t attaquants(short position, short joueur, uint64_t occupation) const;
+  uint64_t echecs(short joueur) const;
+  uint64_t cloues(short joueur) const;
+
+  int genererCoups(short joueur, Coup *liste, uint64_t departs = ~0ULL) const;
+  Coup trouverCoup(short joueur, short depart, short arrivee) const;
+  void jouer(Coup coup);
+
+  static void tourRoque(Coup coup, short &depart, short &arrivee);
+  static short typePiece(char piece);
+  static char symbolePiece(short type);
+  static short indexJoueur(short joueur);
+
+private:
+  // Un _ devant une variable indique que celle-ci est propre a une instance de type Board
+
+  uint8_t _cases[64];   // Octet de chaque case. Voir OCTET_...
+  uint64_t _joueurs[2]; // Cases occupees par chaque joueur. [0] pour blanc, [1] pour noir
+  uint64_t _pieces[6];  // Cases occupees par chaque type de piece, peu importe le joueur. Voir TypePiece
+  uint64_t _aBouger;    // Cases modifiees par le deplacement d'une piece
+  uint64_t _vulnerable; // Cases vulnerables a une prise en passant
+  uint64_t _cle;        // Cle de hachage Zobrist de la position
+  short _trait;         // Joueur qui doit jouer. 1 pour blanc, -1 pour noir
+
+  void ecrire(short position, uint8_t octet);
+  void basculer(short position, uint8_t octet);
+  uint8_t droitsRoque() const;
+};
+#endif
@@ -6,6 +6,7 @@ Ce qui est PUBLIC peut etre acceder dans le code et ce qui est PRIVATE peut seul
 
 Cree par William Walsh, 5 mars 2024
 Derniere mise a jour : 15 mai 2024
+La librairie ne depend pas d'Arduino : elle compile aussi sur un ordinateur (voir Materiel.h)
 */
 
 #ifndef Case_h
@@ -13,7 +14,9 @@ Derniere mise a jour : 15 mai 2024
 #define Case_h
 #define TAILLE 8 // Taille de la grille. 8x8 aux echecs
 
-#include <Arduino.h>
+#include <Board.h>
+#include <ListeCoups.h>
+#include <Disposition.h>
 
 // Stucture. Decrit un deplacement d'une piece
 struct Move
@@ -24,64 +27,54 @@ struct Move
   short toCol;    // Colonne destination
 };
 
-// Objet. Contient toute l'information d'une case ainsi que ses interactions possibles
+// Objet. Vue sur une case d'un Board ainsi que ses interactions possibles
+// La piece, le joueur et les indicateurs sont lus et ecrits directement dans le Board
+// Le nom et l'adresse de DEL sont lus dans les tables de Disposition.h
+// Une Case ne contient qu'un pointeur et un numero de case. La copier ne copie pas la piece
 class Case
 {
 public:
-  Case(char nom[2], char piece, short joueur, short rangee, short colonne, short led);
+  Case(Board *plateau, short rangee, short colonne);
   Case();
 
   const char *getNom() const;
-  int getLed();
+  int getLed() const;
 
-  char getPiece();
+  char getPiece() const;
   void setPiece(char piece);
 
-  short getJoueur();
-  String getCouleur();
+  short getJoueur() const;
+  const char *getCouleur() const;
   void setJoueur(short joueur);
 
-  bool getABouger();
+  bool getABouger() const;
   void setABouger();
 
-  bool getVulnerable();
+  bool getVulnerable() const;
   void setVulnerable(bool vulnerable);
 
-  short getRangee();
+  short getRangee() const;
 
-  short getColonne();
+  short getColonne() const;
+  short getPosition() const;
 
-  String readCase();
-  bool isVide();
+  int readCase(char *texte, int taille) const;
+  bool isVide() const;
 
-  int bougerPiece(Case echiquier[8][8], Move *tableauAction);
-  bool inbounds(short rangee, short colonne);
-  bool echec(Case echiquier[8][8], bool chercheMouvement);
+  int bougerPiece(const Case echiquier[8][8], Move *tableauAction) const;
+  int bougerPiece(const ListeCoups &coupsTour, Move *tableauAction) const;
+  bool inbounds(short rangee, short colonne) const;
+  bool echec(const Case echiquier[8][8], bool chercheMouvement, short joueur = 0) const;
 
 private:
 // Un _ devant une variable indique que celle-ci est propre a une instance de type Case
-// La valeur de _led sera donc differente si on regarde la Case a1 ou la Case g5
+// La valeur de _position sera donc differente si on regarde la Case a1 ou la Case g5
 
-  bool _aBouger = false;    // Indique si cette case a ete modifiee par le deplacement d'une piece
-  bool _vulnerable = false; // Indique si cette case est vulnerable a une prise au passage
-  char _nom[3];             // Indique le nom de cette case. a1, a2, ...
-  char _piece;              // Indique quel piece est sur cette case
-  short _joueur;            // Indique quel joueur a une piece sur cette case
-  short _rangee;            // Indique la rangee de cette case
-  short _colonne;           // Indique la colonne de cette case
-  int _led;                 // Indique l'adresse de la DEL sous cette case
+  Board *_plateau = nullptr; // Indique l'echiquier qui contient la piece, le joueur et les indicateurs de cette case
+  short _position = -1;      // Indique le numero de cette case (rangee * 8 + colonne). -1 si la case n'existe pas
 
-  
-
-  int Pion(Case echiquier[8][8], Move *actionPossible);
-  int Tour(Case echiquier[8][8], Move *actionPossible);
-  int Cavalier(Case echiquier[8][8], Move *actionPossible);
-  int Fou(Case echiquier[8][8], Move *actionPossible);
-  int Reine(Case echiquier[8][8], Move *actionPossible);
-  int Roi(Case echiquier[8][8], Move *actionPossible);
-
-  char majuscule(char symbole);
-
-  
+  char majuscule(char symbole) const;
+  int ajouteAction(Move *actionPossible, int actions, short arrivee) const;
+  int ajouteCoups(Move *actionPossible, int actions, const Coup *coups, int nombre) const;
 };
 #endif
\ No newline at end of file
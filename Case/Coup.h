@@ -0,0 +1,80 @@
+/*
+Coup.h - Representation compacte d'un coup sur 16 bits
+  Bits 0 a 5   : case de depart (rangee * 8 + colonne)
+  Bits 6 a 11  : case d'arrivee
+  Bits 12 a 15 : drapeaux. Indiquent une capture, un roque, une prise en passant ou une promotion
+Un coup ne contient pas la piece deplacee. Elle est lue sur l'echiquier au moment de jouer le coup
+*/
+
+#ifndef Coup_h
+
+#define Coup_h
+
+#include <stdint.h>
+
+typedef uint16_t Coup;
+
+#define COUP_NUL 0 // Aucun coup. Le depart et l'arrivee d'un vrai coup sont toujours differents
+
+#define MAX_COUPS 256      // Nombre maximal de coups legaux dans une position (218 au maximum aux echecs)
+#define MAX_COUPS_PIECE 32 // Nombre maximal de coups legaux d'une seule piece (27 pour une reine)
+
+// Drapeaux d'un coup
+#define COUP_NORMAL 0      // Deplacement sans capture
+#define COUP_DOUBLE 1      // Pion qui avance de deux cases
+#define COUP_PETIT_ROQUE 2 // Roque du cote de la colonne 0
+#define COUP_GRAND_ROQUE 3 // Roque du cote de la colonne 7
+#define COUP_CAPTURE 4     // Bit de capture
+#define COUP_EN_PASSANT 5  // Prise en passant. Le bit de capture est actif
+#define COUP_PROMOTION 8   // Bit de promotion. Les 2 bits du bas donnent la piece : 0 cavalier, 1 fou, 2 tour, 3 reine
+
+// Cree un coup a partir de sa case de depart, de sa case d'arrivee et de ses drapeaux
+inline Coup creerCoup(short depart, short arrivee, uint8_t drapeaux)
+{
+  return depart | (arrivee << 6) | (drapeaux << 12);
+}
+
+// Retourne la case de depart d'un coup
+inline short departCoup(Coup coup)
+{
+  return coup & 0x3F;
+}
+
+// Retourne la case d'arrivee d'un coup
+inline short arriveeCoup(Coup coup)
+{
+  return (coup >> 6) & 0x3F;
+}
+
+// Retourne les drapeaux d'un coup
+inline uint8_t drapeauxCoup(Coup coup)
+{
+  return coup >> 12;
+}
+
+// Verifie si un coup capture une piece, incluant la prise en passant
+inline bool estCapture(Coup coup)
+{
+  return drapeauxCoup(coup) & COUP_CAPTURE;
+}
+
+// Verifie si un coup est une promotion
+inline bool estPromotion(Coup coup)
+{
+  return drapeauxCoup(coup) & COUP_PROMOTION;
+}
+
+// Verifie si un coup est un roque
+inline bool estRoque(Coup coup)
+{
+  return drapeauxCoup(coup) == COUP_PETIT_ROQUE || drapeauxCoup(coup) == COUP_GRAND_ROQUE;
+}
+
+// Retourne le type de la piece choisie lors d'une promotion. Voir TypePiece
+// 1 cavalier, 2 fou, 3 tour, 4 reine
+inline short promotionCoup(Coup coup)
+{
+  return 1 + (drapeauxCoup(coup) & 3);
+}
+
+#endif
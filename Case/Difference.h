@@ -0,0 +1,43 @@
+/*
+Difference.h - Cases qui ont change entre deux lectures des senseurs
+Les cases changees sont trouvees avec __builtin_ctzll et comptees avec __builtin_popcountll :
+le cout depend du nombre de cases changees, pas des 64 cases. Aucune allocation, la liste a une taille fixe.
+Les lectures ont le format des bitboards : le bit (rangee * 8 + colonne) est actif si une piece est sur la case.
+*/
+
+#ifndef Difference_h
+
+#define Difference_h
+
+#include <stdint.h>
+#include <Board.h>
+
+#define MAX_CHANGEMENTS 8 // Cases gardees dans la liste. Un coup change au plus 4 cases (roque)
+
+// Structure. Changements entre deux lectures du tableau
+struct Difference
+{
+  uint64_t leves;               // Cases qui se sont videes
+  uint64_t poses;               // Cases qui se sont remplies
+  uint8_t nombre;               // Nombre de cases changees, meme au-dela de MAX_CHANGEMENTS
+  short cases[MAX_CHANGEMENTS]; // Les MAX_CHANGEMENTS premieres cases changees, en ordre croissant
+};
+
+// Compare deux lectures du tableau et ecrit leurs changements dans 'difference'
+// Retourne le nombre de cases changees. 0 si les lectures sont identiques
+inline int comparerTableaux(uint64_t avant, uint64_t apres, Difference &difference)
+{
+  uint64_t changement = avant ^ apres;
+
+  difference.leves = changement & avant;
+  difference.poses = changement & apres;
+  difference.nombre = __builtin_popcountll(changement);
+
+  for (int i = 0; changement && i < MAX_CHANGEMENTS; i++)
+  {
+    difference.cases[i] = extraireCase(changement);
+  }
+  return difference.nombre;
+}
+
+#endif
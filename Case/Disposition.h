@@ -0,0 +1,69 @@
+/*
+Disposition.h - Nom et adresse de DEL de chaque case de l'echiquier
+Ces valeurs ne changent jamais pendant une partie. Elles sont generees a la compilation (constexpr)
+et placees dans la memoire flash au lieu d'etre copiees dans chaque case.
+L'index des tables est le numero de la case : rangee * 8 + colonne
+*/
+
+#ifndef Disposition_h
+
+#define Disposition_h
+
+#include <stdint.h>
+
+// Structure. Le nom de chacune des 64 cases. Ex : A1, B5, H8, ...
+struct TableNoms
+{
+  char noms[64][3];
+};
+
+// Structure. L'adresse de la DEL sous chacune des 64 cases
+struct TableDel
+{
+  uint8_t leds[64];
+};
+
+// Genere le nom des cases
+// Le nom de la case devrait etre en minuscule (notation d'echec)
+constexpr TableNoms genererNoms()
+{
+  TableNoms table = {};
+
+  for (short position = 0; position < 64; position++)
+  {
+    table.noms[position][0] = 'A' + position % 8;
+    table.noms[position][1] = '1' + position / 8;
+    table.noms[position][2] = '\0';
+  }
+  return table;
+}
+
+// Genere l'adresse des DEL adressables de chaque case
+// Le ruban de DEL fait un serpentin : la direction des DEL change a chaque rangee
+constexpr TableDel genererDel()
+{
+  TableDel table = {};
+
+  for (short position = 0; position < 64; position++)
+  {
+    short rangee = position / 8;
+    short colonne = position % 8;
+
+    if (rangee % 2 == 0)
+    {
+      table.leds[position] = rangee * 8 + colonne;
+    }
+    else
+    {
+      table.leds[position] = (rangee + 1) * 8 - colonne - 1;
+    }
+  }
+  return table;
+}
+
+// Nom de chaque case
+inline constexpr TableNoms NOMS_CASES = genererNoms();
+// Adresse de la DEL de chaque case
+inline constexpr TableDel DEL_CASES = genererDel();
+
+#endif
@@ -0,0 +1,198 @@
+#include <Fen.h>
+#include <string.h>
+#include <stdio.h>
+
+// Convertit une lettre de colonne FEN ('a' a 'h') en colonne du Board. -1 si la lettre est invalide
+short colonneFen(char lettre)
+{
+  if (lettre < 'a' || lettre > 'h')
+  {
+    return -1;
+  }
+  return TAILLE - 1 - (lettre - 'a');
+}
+
+// Convertit une colonne du Board en lettre de colonne FEN
+char lettreFen(short colonne)
+{
+  return 'a' + TAILLE - 1 - colonne;
+}
+
+// Remplace la position de 'plateau' par celle d'une chaine FEN
+// Les compteurs de demi-coups et de coups sont ignores
+// Retourne false si la chaine est invalide. Le plateau est alors vide
+bool lireFen(Board &plateau, const char *fen)
+{
+  short rangee = TAILLE - 1;
+  short colonne = 0; // Index de colonne FEN, 0 pour 'a'
+  const char *c = fen;
+
+  plateau.vider();
+
+  // Pieces, de la rangee 8 a la rangee 1 et de la colonne 'a' a la colonne 'h'
+  for (; *c && *c != ' '; c++)
+  {
+    if (*c == '/')
+    {
+      rangee--;
+      colonne = 0;
+    }
+    else if (*c >= '1' && *c <= '8')
+    {
+      colonne += *c - '0';
+    }
+    else if (Board::typePiece(*c) != AUCUNE && rangee >= 0 && colonne < TAILLE)
+    {
+      plateau.placer(numeroCase(rangee, TAILLE - 1 - colonne), *c, (*c >= 'a') ? -1 : 1);
+      colonne++;
+    }
+    else
+    {
+      plateau.vider();
+      return false;
+    }
+  }
+  if (rangee != 0 || *c != ' ')
+  {
+    plateau.vider();
+    return false;
+  }
+
+  // Trait
+  c++;
+  plateau.setTrait((*c == 'b') ? -1 : 1);
+  while (*c && *c != ' ')
+  {
+    c++;
+  }
+
+  // Droits de roque. Une tour sans droit est marquee comme deplacee
+  const char *roques = (*c == ' ') ? c + 1 : c;
+  const char symboles[] = "KQkq";
+  bool droits[4] = {false, false, false, false}; // Dans l'ordre de 'symboles'
+  const short coins[4] = {numeroCase(0, 0), numeroCase(0, TAILLE - 1), numeroCase(TAILLE - 1, 0), numeroCase(TAILLE - 1, TAILLE - 1)};
+
+  for (c = roques; *c && *c != ' '; c++)
+  {
+    const char *droit = strchr(symboles, *c);
+
+    if (droit != nullptr)
+    {
+      droits[droit - symboles] = true;
+    }
+  }
+  for (short i = 0; i < 4; i++)
+  {
+    if (!droits[i])
+    {
+      plateau.setABouger(coins[i]);
+    }
+  }
+
+  // Case de prise en passant
+  if (*c == ' ' && c[1] != '-' && c[1] != '\0')
+  {
+    short colonneCase = colonneFen(c[1]);
+    short rangeeCase = c[2] - '1';
+
+    if (colonneCase >= 0 && rangeeCase >= 0 && rangeeCase < TAILLE)
+    {
+      plateau.setVulnerable(numeroCase(rangeeCase, colonneCase), true);
+    }
+  }
+  return true;
+}
+
+// Ecrit la position de 'plateau' en notation FEN dans 'fen'
+// taille : taille du tampon. TAILLE_FEN suffit pour toute position
+// Les compteurs de demi-coups et de coups sont toujours 0 et 1
+// Retourne le nombre de caracteres ecrits, sans le '\0'
+int ecrireFen(const Board &plateau, char *fen, int taille)
+{
+  char tampon[TAILLE_FEN];
+  int n = 0;
+
+  // Pieces
+  for (short rangee = TAILLE - 1; rangee >= 0; rangee--)
+  {
+    short vides = 0;
+
+    for (short colonne = TAILLE - 1; colonne >= 0; colonne--)
+    {
+      short position = numeroCase(rangee, colonne);
+      char piece = plateau.getPiece(position);
+
+      if (plateau.getJoueur(position) == 0 || piece == ' ')
+      {
+        vides++;
+        continue;
+      }
+      if (vides)
+      {
+        tampon[n++] = '0' + vides;
+        vides = 0;
+      }
+      tampon[n++] = (plateau.getJoueur(position) < 0) ? piece + 'a' - 'A' : piece;
+    }
+    if (vides)
+    {
+      tampon[n++] = '0' + vides;
+    }
+    if (rangee > 0)
+    {
+      tampon[n++] = '/';
+    }
+  }
+
+  // Trait
+  tampon[n++] = ' ';
+  tampon[n++] = (plateau.getTrait() < 0) ? 'b' : 'w';
+  tampon[n++] = ' ';
+
+  // Droits de roque : roi et tour sur leurs cases de depart, sans avoir bouge
+  int debutRoques = n;
+  const char symboles[4] = {'K', 'Q', 'k', 'q'};
+
+  for (short i = 0; i < 4; i++)
+  {
+    short joueur = (i < 2) ? 1 : -1;
+    short rangee = (i < 2) ? 0 : TAILLE - 1;
+    short roi = numeroCase(rangee, COLONNE_ROI);
+    short tour = numeroCase(rangee, (i % 2 == 0) ? 0 : TAILLE - 1);
+
+    if (plateau.getPiece(roi) == 'K' && plateau.getJoueur(roi) == joueur && !plateau.getABouger(roi) &&
+        plateau.getPiece(tour) == 'R' && plateau.getJoueur(tour) == joueur && !plateau.getABouger(tour))
+    {
+      tampon[n++] = symboles[i];
+    }
+  }
+  if (n == debutRoques)
+  {
+    tampon[n++] = '-';
+  }
+
+  // Case de prise en passant
+  tampon[n++] = ' ';
+  if (plateau.vulnerables())
+  {
+    short position = __builtin_ctzll(plateau.vulnerables());
+
+    tampon[n++] = lettreFen(position % TAILLE);
+    tampon[n++] = '1' + position / TAILLE;
+  }
+  else
+  {
+    tampon[n++] = '-';
+  }
+
+  memcpy(tampon + n, " 0 1", 5);
+  n += 4;
+
+  if (n >= taille)
+  {
+    n = taille - 1;
+  }
+  memcpy(fen, tampon, n);
+  fen[n] = '\0';
+  return n;
+}
@@ -0,0 +1,24 @@
+/*
+Fen.h - Lecture et ecriture d'une position en notation FEN
+Ex : rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1
+Le roi blanc commence sur la colonne 3 du Board (voir initialiseGrille) alors qu'il est en e1 en FEN :
+la colonne 'a' de la notation FEN est donc la colonne 7 du Board et la colonne 'h' est la colonne 0.
+Les droits de roque sont les indicateurs "a bouge" des cases de depart des tours.
+La case de prise en passant est l'indicateur "vulnerable" de la case sautee par le pion.
+*/
+
+#ifndef Fen_h
+
+#define Fen_h
+
+#include <Board.h>
+
+#define FEN_DEPART "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1" // Position de depart
+#define TAILLE_FEN 92 // Taille maximale d'une chaine FEN, incluant le '\0'
+
+bool lireFen(Board &plateau, const char *fen);
+int ecrireFen(const Board &plateau, char *fen, int taille);
+short colonneFen(char lettre);
+char lettreFen(short colonne);
+
+#endif
@@ -0,0 +1,137 @@
+#include <Finales.h>
+#include <FinalesDonnees.h>
+
+const char *const NOMS_FINALES[FINALE_AUCUNE] = {"KPK", "KRK", "KQK"};
+
+// Index du roi fort dans le triangle de 10 cases, par (rangee * 4 + colonne). -1 hors du triangle
+static const int8_t TRIANGLE[16] = {
+    0, 1, 2, 3,
+    -1, 4, 5, 6,
+    -1, -1, 7, 8,
+    -1, -1, -1, 9};
+
+// Retourne la finale de la position et le joueur qui a la piece ('fort'), ou FINALE_AUCUNE
+// Exactement trois pieces : les deux rois et un pion, une tour ou une dame
+TypeFinale typeFinale(const Board &plateau, short &fort)
+{
+  uint64_t occupation = plateau.occupation();
+
+  if (__builtin_popcountll(occupation) != 3 || plateau.roi(1) < 0 || plateau.roi(-1) < 0)
+  {
+    return FINALE_AUCUNE;
+  }
+
+  fort = (__builtin_popcountll(plateau.pieces(1)) == 2) ? 1 : -1;
+  if (plateau.pieces('P', fort))
+  {
+    return FINALE_KPK;
+  }
+  if (plateau.pieces('R', fort))
+  {
+    return FINALE_KRK;
+  }
+  if (plateau.pieces('Q', fort))
+  {
+    return FINALE_KQK;
+  }
+  return FINALE_AUCUNE;
+}
+
+// Retourne l'index d'une position dans la table de sa finale. Les cases sont celles du Board (rangee * 8 + colonne)
+// Le camp fort joue vers la rangee 7 : pour un pion noir, retourner les rangees (case ^ 56) avant l'appel
+// traitFort : le camp fort a le trait. piece : case du pion, de la tour ou de la dame
+uint32_t indexFinale(TypeFinale type, bool traitFort, short roiFort, short roiFaible, short piece)
+{
+  uint32_t trait = traitFort ? 0 : 1;
+
+  if (type == FINALE_KPK)
+  {
+    // Symetrie horizontale seulement : le pion ne recule pas
+    if (piece % TAILLE < 4)
+    {
+      roiFort ^= 7;
+      roiFaible ^= 7;
+      piece ^= 7;
+    }
+    uint32_t pion = (piece / TAILLE - 1) * 4 + (piece % TAILLE - 4); // Rangees 1 a 6, colonnes 4 a 7
+
+    return ((trait * 24 + pion) * 64 + roiFaible) * 64 + roiFort;
+  }
+
+  // Le roi fort est ramene sur les colonnes 0 a 3, les rangees 0 a 3, puis sous la diagonale
+  if (roiFort % TAILLE >= 4)
+  {
+    roiFort ^= 7;
+    roiFaible ^= 7;
+    piece ^= 7;
+  }
+  if (roiFort / TAILLE >= 4)
+  {
+    roiFort ^= 56;
+    roiFaible ^= 56;
+    piece ^= 56;
+  }
+  if (roiFort / TAILLE > roiFort % TAILLE)
+  {
+    roiFort = (roiFort % TAILLE) * TAILLE + roiFort / TAILLE;
+    roiFaible = (roiFaible % TAILLE) * TAILLE + roiFaible / TAILLE;
+    piece = (piece % TAILLE) * TAILLE + piece / TAILLE;
+  }
+
+  return ((trait * 64 + roiFaible) * 64 + piece) * 10 + TRIANGLE[(roiFort / TAILLE) * 4 + roiFort % TAILLE];
+}
+
+// Retourne le nombre de positions de la table d'une finale
+uint32_t positionsFinale(TypeFinale type)
+{
+  return TABLES_FINALES[type].positions;
+}
+
+// Retourne la valeur d'une position de la table : vrai si le camp fort gagne
+// Un bloc uniforme est lu dans son groupe. Un bloc mixte est trouve par son rang parmi les blocs mixtes
+bool lireFinale(TypeFinale type, uint32_t index)
+{
+  const TableFinale &table = TABLES_FINALES[type];
+  uint32_t bloc = index / 64;
+  uint32_t groupe = bloc / 32;
+  uint32_t bit = 1UL << (bloc % 32);
+
+  if (!(table.mixtes[groupe] & bit))
+  {
+    return table.uniformes[groupe] & bit;
+  }
+  uint32_t rang = table.rangs[groupe] + __builtin_popcount(table.mixtes[groupe] & (bit - 1));
+
+  return (table.blocs[rang] >> (index % 64)) & 1;
+}
+
+// Retourne la finale de la position et son resultat avec un jeu parfait : 'gagnant' est 1 (blancs), -1 (noirs) ou 0 (nulle)
+// FINALE_AUCUNE si la position n'est dans aucune table ('gagnant' n'est alors pas modifie)
+TypeFinale sonderFinale(const Board &plateau, short &gagnant)
+{
+  short fort;
+  TypeFinale type = typeFinale(plateau, fort);
+
+  if (type == FINALE_AUCUNE)
+  {
+    return type;
+  }
+
+  short roiFort = plateau.roi(fort);
+  short roiFaible = plateau.roi(-fort);
+  short piece = __builtin_ctzll(plateau.pieces(fort) & ~bitCase(roiFort));
+
+  if (type == FINALE_KPK && fort < 0)
+  {
+    roiFort ^= 56;
+    roiFaible ^= 56;
+    piece ^= 56;
+  }
+  // Un pion sur sa premiere ou sa derniere rangee n'a pas d'index (position importee invalide)
+  if (type == FINALE_KPK && (piece / TAILLE == 0 || piece / TAILLE == TAILLE - 1))
+  {
+    return FINALE_AUCUNE;
+  }
+  gagnant = lireFinale(type, indexFinale(type, plateau.getTrait() == fort, roiFort, roiFaible, piece)) ? fort : 0;
+  return type;
+}
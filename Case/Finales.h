@@ -0,0 +1,59 @@
+/*
+Finales.h - Tables de finales (bitbases) : gain ou nulle des finales roi et pion, roi et tour, roi et dame contre roi seul
+Chaque table donne un bit par position : 1 si le camp fort (celui qui a la piece) gagne, 0 si la partie est nulle.
+Les tables sont generees sur un ordinateur par analyse retrograde (Finales/finales.cpp) et compilees avec la librairie
+(FinalesDonnees.h) : une consultation coute un calcul d'index, un __builtin_popcount et deux lectures, en temps constant.
+
+Index d'une position :
+  - Les symetries de l'echiquier reduisent les tables. Roi et tour, roi et dame : le roi fort est ramene dans le triangle
+    de 10 cases (rangees 0 a 3, colonnes 0 a 3, rangee <= colonne) par symetries horizontale, verticale et diagonale.
+    Roi et pion : le pion avance toujours vers la rangee 7 (les noirs sont retournes) et est ramene sur les colonnes 4 a 7.
+  - Trait (camp fort ou faible), case du roi faible (ou du pion), case de la piece forte (ou du roi faible), puis roi fort.
+    Le roi fort varie le plus vite : ses cases voisines ont presque toujours la meme valeur, et les blocs sont plus souvent uniformes.
+
+Compression : les positions sont groupees par blocs de 64. Un bloc dont toutes les positions legales ont la meme valeur
+est uniforme et ne coute qu'un bit ; les positions illegales (rois voisins, camp qui n'a pas le trait en echec, cases
+communes) prennent la valeur de leur bloc. Seuls les blocs mixtes sont gardes, 8 octets chacun, et le rang d'un bloc mixte
+est le nombre de blocs mixtes avant son groupe de 32 blocs plus un __builtin_popcount dans le groupe.
+Les promotions ne donnent qu'une dame, comme sur l'echiquier. Les droits de roque ne sont pas consideres.
+*/
+
+#ifndef Finales_h
+
+#define Finales_h
+
+#include <stdint.h>
+#include <Board.h>
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+// Finales connues
+enum TypeFinale
+{
+  FINALE_KPK, // Roi et pion contre roi
+  FINALE_KRK, // Roi et tour contre roi
+  FINALE_KQK, // Roi et dame contre roi
+  FINALE_AUCUNE // La position n'est dans aucune table. Doit rester le dernier
+};
+
+// Structure. Table de finale compressee. Voir FinalesDonnees.h
+struct TableFinale
+{
+  uint32_t positions;        // Positions de la table (index de 0 a positions - 1)
+  const uint32_t *mixtes;    // Un bit par bloc de 64 positions, par groupes de 32 blocs : actif si le bloc est mixte
+  const uint32_t *uniformes; // Valeur des blocs uniformes, au meme format
+  const uint16_t *rangs;     // Nombre de blocs mixtes avant chaque groupe de 32 blocs
+  const uint64_t *blocs;     // Blocs mixtes : un bit par position
+};
+
+extern const char *const NOMS_FINALES[FINALE_AUCUNE];
+
+TypeFinale typeFinale(const Board &plateau, short &fort);
+uint32_t indexFinale(TypeFinale type, bool traitFort, short roiFort, short roiFaible, short piece);
+uint32_t positionsFinale(TypeFinale type);
+bool lireFinale(TypeFinale type, uint32_t index);
+TypeFinale sonderFinale(const Board &plateau, short &gagnant);
+
+#endif
@@ -0,0 +1,330 @@
+/*
+FinalesDonnees.h - Tables de finales generees par Finales/finales.cpp. Ne pas modifier a la main
+Inclus seulement par Finales.cpp. Format des tables : voir Finales.h
+*/
+
+#ifndef FinalesDonnees_h
+
+#define FinalesDonnees_h
+
+#include <Finales.h>
+
+// KPK : 196608 positions, 1267 blocs mixtes, 11096 octets
+static const uint32_t KPK_MIXTES[96] PROGMEM = {
+    0xEFC70000, 0x7CFFFFFF, 0xDF8F0000, 0xFCFFFFFF, 0xBE1E0000, 0xFCFEFEFE, 0x3C3C0000, 0x1C1C1C1C,
+    0xC7EF0000, 0xFFFFFFEF, 0x8FDF0000, 0xFFFFFFDF, 0x1EBE0000, 0xFEFEFEBE, 0x3C7C0000, 0x1C1C1C1C,
+    0xEF000000, 0xFFFFEFC7, 0xDE000000, 0xFEFEDE8E, 0xBC000000, 0xFCFCBC1C, 0x78000000, 0x18181838,
+    0x00000000, 0xFEEEC6EE, 0x00000000, 0xFCDC8CDC, 0x00000000, 0xF8B818B8, 0x00000000, 0x10103070,
+    0x00000000, 0x7C446C00, 0x00000000, 0xF888D800, 0x00000000, 0xF010B000, 0x00000000, 0x20006000,
+    0x00000000, 0x10280000, 0x00000000, 0x20D00000, 0x00000000, 0x40A08000, 0x00000000, 0x20200000,
+    0xEFEFEF38, 0xFFFFFFFF, 0xDFDFDF70, 0xFFFFFFFF, 0xBFBFBFE0, 0xFFFFFFFF, 0x1E3E3EC0, 0x1E1E1E1E,
+    0xEFEFFF00, 0xFFFFFFEF, 0xDFDFFF00, 0xFFFFFFDF, 0xBFBFFF00, 0xFFFFFFBF, 0x1E3EFE00, 0x1E1E1E1E,
+    0xEFFF0000, 0xFFFFEFEF, 0xDFFF0000, 0xFFFFDFDF, 0xBEFE0000, 0xFEFEBEBE, 0x3CFC0000, 0x1C1C1C1C,
+    0xFF000000, 0xFFEFEFEF, 0xFE000000, 0xFEDEDEDE, 0xFC000000, 0xFCBCBCBC, 0xF8000000, 0x18181838,
+    0x00000000, 0xEEEEEEFE, 0x00000000, 0xDCDCDCFC, 0x00000000, 0xB8B8B8F8, 0x00000000, 0x101030F0,
+    0x00000000, 0x7C6C7C00, 0x00000000, 0xF8D8F800, 0x00000000, 0xF0B0F000, 0x00000000, 0x3030F000};
+
+static const uint32_t KPK_UNIFORMES[96] PROGMEM = {
+    0x0000EFFF, 0x83000000, 0x0000DFFF, 0x03000000, 0x0101BFFF, 0x03010101, 0x03037FFF, 0x03030303,
+    0x0000FFFF, 0x00000000, 0x0000FFFF, 0x00000000, 0x0101FFFF, 0x01010101, 0x0303FFFF, 0x03030303,
+    0x00FFFFFF, 0x00000000, 0x01FFFFFF, 0x01010101, 0x03FFFFFF, 0x03030303, 0x07FFFFFF, 0x07070707,
+    0xFFFFFFFF, 0x01010101, 0xFFFFFFFF, 0x03030303, 0xFFFFFFFF, 0x07070707, 0xFFFFFFFF, 0x0F0F0F0F,
+    0xFFFFFFFF, 0x838383FF, 0xFFFFFFFF, 0x070707FF, 0xFFFFFFFF, 0x0F0F0FFF, 0xFFFFFFFF, 0x1F1F1FFF,
+    0xFFFFFFFF, 0xC7C7FFFF, 0xFFFFFFFF, 0x8F0FFFFF, 0xFFFFFFFF, 0x1F1F7FFF, 0xFFFFFFFF, 0x1F1FFFFF,
+    0x000000C7, 0x00000000, 0x0000008F, 0x00000000, 0x0000001F, 0x00000000, 0x0101013F, 0x01010101,
+    0x000000FF, 0x00000000, 0x000000FF, 0x00000000, 0x000000FF, 0x00000000, 0x010101FF, 0x01010101,
+    0x0000FFFF, 0x00000000, 0x0000FFFF, 0x00000000, 0x0101FFFF, 0x01010101, 0x0303FFFF, 0x03030303,
+    0x00FFFFFF, 0x00000000, 0x01FFFFFF, 0x01010101, 0x03FFFFFF, 0x03030303, 0x07FFFFFF, 0x07070707,
+    0xFFFFFFFF, 0x01010101, 0xFFFFFFFF, 0x03030303, 0xFFFFFFFF, 0x07070707, 0xFFFFFFFF, 0x0F0F0F0F,
+    0xFFFFFFFF, 0x838383FF, 0xFFFFFFFF, 0x070707FF, 0xFFFFFFFF, 0x0F0F0FFF, 0xFFFFFFFF, 0x0F0F0FFF};
+
+static const uint16_t KPK_RANGS[96] PROGMEM = {
+    0x0000, 0x000C, 0x0029, 0x0035, 0x0053, 0x005D, 0x0078, 0x0080,
+    0x008C, 0x0098, 0x00B7, 0x00C3, 0x00E2, 0x00EC, 0x0107, 0x0110,
+    0x011C, 0x0123, 0x013F, 0x0145, 0x015D, 0x0162, 0x0176, 0x017A,
+    0x0183, 0x0183, 0x019A, 0x019A, 0x01AD, 0x01AD, 0x01BC, 0x01BC,
+    0x01C3, 0x01C3, 0x01CE, 0x01CE, 0x01D9, 0x01D9, 0x01E1, 0x01E1,
+    0x01E4, 0x01E4, 0x01E7, 0x01E7, 0x01EB, 0x01EB, 0x01EF, 0x01EF,
+    0x01F1, 0x0209, 0x0229, 0x0241, 0x0261, 0x0279, 0x0299, 0x02A9,
+    0x02B9, 0x02CF, 0x02EE, 0x0304, 0x0323, 0x0339, 0x0358, 0x0368,
+    0x0378, 0x0387, 0x03A5, 0x03B4, 0x03D2, 0x03DF, 0x03F9, 0x0403,
+    0x040F, 0x0417, 0x0434, 0x043B, 0x0454, 0x045A, 0x046F, 0x0474,
+    0x047D, 0x047D, 0x0496, 0x0496, 0x04AB, 0x04AB, 0x04BC, 0x04BC,
+    0x04C4, 0x04C4, 0x04D2, 0x04D2, 0x04E0, 0x04E0, 0x04EB, 0x04EB};
+
+static const uint64_t KPK_BLOCS[1267] PROGMEM = {
+    0xFEFEFFFFFCFCECFE, 0x00FCFFFFF8F8E8FC, 0x0000FEFEF0F0E0F0, 0x0000FEFE1E1E0E1E, 0x007FFFFF3F3F2F7F, 0xFEFEFEFCFCFCEEFE, 0x00FCFCF8F8F8ECFC, 0x0000F8F0F0F0E8F0,
+    0x0000006060606000, 0x0000000C0C0C0C00, 0x00003E1E1E1E2E1E, 0x007F7F3F3F3F6F7F, 0xFEFEFCFCFCFEEFFE, 0x00FCF8F8F8FDEFFC, 0x0000F0F0F0FAEEF0, 0x0000606060746C00,
+    0x0000000000282800, 0x00000C0C0C5C6C00, 0x00001E1E1EBEEE1E, 0x007F3F3F3F7FEF7F, 0xFEFCFCFCFFFFEEFE, 0x00F8F8F8FFFFECFC, 0x00F0F0F0FEFEE8F0, 0x006060607C7C6000,
+    0x000000447C7C0000, 0x000C0C0C7C7C0C00, 0x001E1E1EFEFE2E1E, 0x003F3F3FFFFF6F7F, 0xFCFCFCFFFFFFEFFE, 0xF8F8F8FFFFFFEFFC, 0xF0F0F0FEFEFEEEF0, 0x6060E2FEFEFEEE00,
+    0x0000C6FEFEFEEE00, 0x0C0C8EFEFEFEEE00, 0x1E1E1EFEFEFEEE1E, 0x3F3F3FFFFFFFEF7F, 0xF0F1FFFFFFFFEFFF, 0x60E3FFFFFFFFEFFF, 0x00C7FFFFFFFFEFFF, 0x0C8FFFFFFFFFEFFF,
+    0x1E1FFFFFFFFFEFFF, 0xFEFEFFFFFCFCDCFE, 0xFCFCFFFFF8F8D8FC, 0x00F8FEFEF0F0D0F8, 0x0000FCFCE0E0C0E0, 0x0000FCFC3C3C1C3C, 0xFEFEFEFCFCFCDEFE, 0xFCFCFCF8F8F8DCFC,
+    0x00F8F8F0F0F0D8F8, 0x0000F0E0E0E0D0E0, 0x000000C0C0C0C000, 0x0000001818181800, 0x00007C3C3C3C5C3C, 0xFEFEFCFCFCFEDFFE, 0xFCFCF8F8F8FDDFFC, 0x00F8F0F0F0FADEF8,
+    0x0000E0E0E0F4DCE0, 0x0000C0C0C0E8D800, 0x0000000000505000, 0x0000181818B8D800, 0x00003C3C3C7CDC3C, 0xFEFCFCFCFFFFDEFE, 0xFCF8F8F8FFFFDCFC, 0x00F0F0F0FEFED8F8,
+    0x00E0E0E0FCFCD0E0, 0x00C0C0C0F8F8C000, 0x00000088F8F80000, 0x00181818F8F81800, 0x003C3C3CFCFC5C3C, 0xFCFCFCFFFFFFDFFE, 0xF8F8F8FFFFFFDFFC, 0xF0F0F0FEFEFEDEF8,
+    0xE0E0E0FCFCFCDCE0, 0xC0C0C4FCFCFCDC00, 0x00008CFCFCFCDC00, 0x18181CFCFCFCDC00, 0x3C3C3CFCFCFCDC3C, 0xF0F0FEFEFEFEDEFE, 0xE0E2FEFEFEFEDEFE, 0xC0C6FEFEFEFEDEFE,
+    0x008EFEFEFEFEDEFE, 0x181EFEFEFEFEDEFE, 0x3C3EFEFEFEFEDEFE, 0xFCFCFFFFF8F8B8FC, 0xF8F8FEFEF0F0B0F8, 0x00F0FCFCE0E0A0F0, 0x0000F8F8C0C080C0, 0xFCFCFCF8F8F8BCFC,
+    0xF8F8F8F0F0F0B8F8, 0x00F0F0E0E0E0B0F0, 0x0000E0C0C0C0A0C0, 0x0000008080808000, 0x0000003030303000, 0xFCFCF8F8F8FDBFFC, 0xF8F8F0F0F0FABEF8, 0x00F0E0E0E0F4BCF0,
+    0x0000C0C0C0E8B8C0, 0x0000808080D0B000, 0x0000000000A0A000, 0x000030303070B000, 0xFCF8F8F8FFFFBCFC, 0xF8F0F0F0FEFEB8F8, 0x00E0E0E0FCFCB0F0, 0x00C0C0C0F8F8A0C0,
+    0x00808080F0F08000, 0x00000010F0F00000, 0x00303030F0F03000, 0xF8F8F8FFFFFFBFFC, 0xF0F0F0FEFEFEBEF8, 0xE0E0E0FCFCFCBCF0, 0xC0C0C0F8F8F8B8C0, 0x808088F8F8F8B800,
+    0x000018F8F8F8B800, 0x303038F8F8F8B800, 0xF0F0FEFEFEFEBEFE, 0xE0E0FCFCFCFCBCFC, 0xC0C4FCFCFCFCBCFC, 0x808CFCFCFCFCBCFC, 0x001CFCFCFCFCBCFC, 0x303CFCFCFCFCBCFC,
+    0xF8F8FEFEF0F07000, 0xF0F0FCFCE0E06000, 0x00E0F8F8C0C04000, 0x0000F0F080000000, 0xF8F8F8F0F0F00000, 0xF0F0F0E0E0E00000, 0x00E0E0C0C0C00000, 0x0000400000000000,
+    0xF8F8F0F0F0000000, 0xF0F0E0E0E0000000, 0x00E0C0C0C0000000, 0xF8F0F0F0F8000000, 0xF0E0E0E000000000, 0x00C0C0C000000000, 0xF0F0F0F8F8000000, 0xE0E0E0F000000000,
+    0xC0C0C00000000000, 0xF0F0F8F8F8000000, 0xE0E0F0F000000000, 0xC0C0E00000000000, 0xFEFEFFFFFCECFCFE, 0x00FCFEFEF8E8F8F8, 0x0000FCFCF0E0F0F8, 0x0000007860606000,
+    0x0000003C0C0C0C00, 0x00007E7E1E0E1E3E, 0x007FFFFF3F2F3F3F, 0xFEFEFEFCFCECFEFE, 0x00FCFCF8F8E8FCF8, 0x0000F8F0F0E0F000, 0x00003E1E1E0E1E00, 0x007F7F3F3F2F7F3F,
+    0xFEFEFCFCFCEEFEFE, 0x00FCF8F8F8ECFCF8, 0x00F8F0F0F0E8F000, 0x0000606060600000, 0x00000C0C0C0C0000, 0x003E1E1E1E2E1E00, 0x007F3F3F3F6F7F3F, 0xFEFCFCFCFEEFFEFE,
+    0xFCF8F8F8FDEFFCF8, 0x00F0F0F0FAEEF000, 0x00606060746C0000, 0x0000000028280000, 0x000C0C0C5C6C0000, 0x001E1E1EBEEE1E00, 0x7F3F3F3F7FEF7F3F, 0xFCFCFCFFFFEEFEFE,
+    0xF8F8F8FFFFECFCF8, 0xF0F0F0FEFEE8F000, 0x6060607C7C600000, 0x0000447C7C000000, 0x0C0C0C7C7C0C0000, 0x1E1E1EFEFE2E1E00, 0x3F3F3FFFFF6F7F3F, 0xFCFCFFFFFFEFFEFE,
+    0xF8F8FFFFFFEFFCF8, 0xF0F0FEFEFEEEF000, 0x60E2FEFEFEEE0000, 0x00C6FEFEFEEE0000, 0x0C8EFEFEFEEE0000, 0x1E1EFEFEFEEE1E00, 0x3F3FFFFFFFEF7F3F, 0xFEFEFFFFFCDCFCFE,
+    0xFCFCFEFEF8D8F8FC, 0x00F8FCFCF0D0F0F0, 0x0000F8F8E0C0E0F0, 0x000000F0C0C0C000, 0x0000007818181800, 0x0000FCFC3C1C3C7C, 0xFEFEFEFCFCDCFEFE, 0xFCFCFCF8F8D8FCFC,
+    0x00F8F8F0F0D0F8F0, 0x0000F0E0E0C0E000, 0x00007C3C3C1C3C00, 0xFEFEFCFCFCDEFEFE, 0xFCFCF8F8F8DCFCFC, 0x00F8F0F0F0D8F8F0, 0x00F0E0E0E0D0E000, 0x0000C0C0C0C00000,
+    0x0000181818180000, 0x007C3C3C3C5C3C00, 0xFEFCFCFCFEDFFEFE, 0xFCF8F8F8FDDFFCFC, 0xF8F0F0F0FADEF8F0, 0x00E0E0E0F4DCE000, 0x00C0C0C0E8D80000, 0x0000000050500000,
+    0x00181818B8D80000, 0x003C3C3C7CDC3C00, 0xFCFCFCFFFFDEFEFE, 0xF8F8F8FFFFDCFCFC, 0xF0F0F0FEFED8F8F0, 0xE0E0E0FCFCD0E000, 0xC0C0C0F8F8C00000, 0x000088F8F8000000,
+    0x181818F8F8180000, 0x3C3C3CFCFC5C3C00, 0xFCFCFFFFFFDFFEFE, 0xF8F8FFFFFFDFFCFC, 0xF0F0FEFEFEDEF8F0, 0xE0E0FCFCFCDCE000, 0xC0C4FCFCFCDC0000, 0x008CFCFCFCDC0000,
+    0x181CFCFCFCDC0000, 0x3C3CFCFCFCDC3C00, 0xFCFCFEFEF8B8F8FC, 0xF8F8FCFCF0B0F0F8, 0x00F0F8F8E0A0E0E0, 0x0000F0F0C080C0E0, 0x000000E080808000, 0x000000F030303000,
+    0xFCFCFCF8F8B8FCFC, 0xF8F8F8F0F0B0F8F8, 0x00F0F0E0E0A0F0E0, 0x0000E0C0C080C000, 0xFCFCF8F8F8BCFCFC, 0xF8F8F0F0F0B8F8F8, 0x00F0E0E0E0B0F0E0, 0x00E0C0C0C0A0C000,
+    0x0000808080800000, 0x0000303030300000, 0xFCF8F8F8FDBFFCFC, 0xF8F0F0F0FABEF8F8, 0xF0E0E0E0F4BCF0E0, 0x00C0C0C0E8B8C000, 0x00808080D0B00000, 0x00000000A0A00000,
+    0x0030303070B00000, 0xF8F8F8FFFFBCFCFC, 0xF0F0F0FEFEB8F8F8, 0xE0E0E0FCFCB0F0E0, 0xC0C0C0F8F8A0C000, 0x808080F0F0800000, 0x000010F0F0000000, 0x303030F0F0300000,
+    0xF8F8FFFFFFBFFCFC, 0xF0F0FEFEFEBEF8F8, 0xE0E0FCFCFCBCF0E0, 0xC0C0F8F8F8B8C000, 0x8088F8F8F8B80000, 0x0018F8F8F8B80000, 0x3038F8F8F8B80000, 0xF8F8FCFCF070F000,
+    0xF0F0F8F8E060E000, 0x00E0F0F0C040C000, 0x0000E0E080000000, 0x000000C000000000, 0xF8F8F8F0F0700000, 0xF0F0F0E0E0600000, 0x00E0E0C0C0400000, 0x0000400000000000,
+    0xF8F8F0F0F0000000, 0xF0F0E0E0E0000000, 0x00E0C0C0C0000000, 0xF8F0F0F0F8000000, 0xF0E0E0E000000000, 0x00C0C0C000000000, 0xF0F0F0F8F8000000, 0xE0E0E0F000000000,
+    0xC0C0C00000000000, 0xF0F0F8F8F8000000, 0xE0E0F0F000000000, 0xC0C0E00000000000, 0xFEFFFFFCECFCFEFC, 0xFCFEFEF8E8F8F800, 0x00FCFCF0E0F0F800, 0x0000786060600000,
+    0x00003C0C0C0C0000, 0x007E7E1E0E1E3E00, 0x7FFFFF3F2F3F3F00, 0xFEFEFCFCECFEFEFC, 0xFCFCF8F8E8FCF800, 0x00F8F0F0E0F00000, 0x003E1E1E0E1E0000, 0x7F7F3F3F2F7F3F00,
+    0xFEFCFCFCEEFEFEFC, 0xFCF8F8F8ECFCF800, 0xF8F0F0F0E8F00000, 0x0060606060000000, 0x000C0C0C0C000000, 0x3E1E1E1E2E1E0000, 0x7F3F3F3F6F7F3F00, 0xFCFCFCFEEFFEFEFC,
+    0xF8F8F8FDEFFCF800, 0xF0F0F0FAEEF00000, 0x606060746C000000, 0x0000002828000000, 0x0C0C0C5C6C000000, 0x1E1E1EBEEE1E0000, 0x3F3F3F7FEF7F3F00, 0xFCFCFFFFEEFEFEFC,
+    0xF8F8FFFFECFCF800, 0xF0F0FEFEE8F00000, 0x60607C7C60000000, 0x00447C7C00000000, 0x0C0C7C7C0C000000, 0x1E1EFEFE2E1E0000, 0x3F3FFFFF6F7F3F00, 0xFCFEFEF8D8F8FCF8,
+    0xF8FCFCF0D0F0F000, 0x00F8F8E0C0E0F000, 0x0000F0C0C0C00000, 0x0000781818180000, 0x00FCFC3C1C3C7C00, 0xFCFCF8F8D8FCFCF8, 0xF8F8F0F0D0F8F000, 0x00F0E0E0C0E00000,
+    0x007C3C3C1C3C0000, 0xFCF8F8F8DCFCFCF8, 0xF8F0F0F0D8F8F000, 0xF0E0E0E0D0E00000, 0x00C0C0C0C0000000, 0x0018181818000000, 0x7C3C3C3C5C3C0000, 0xF8F8F8FDDFFCFCF8,
+    0xF0F0F0FADEF8F000, 0xE0E0E0F4DCE00000, 0xC0C0C0E8D8000000, 0x0000005050000000, 0x181818B8D8000000, 0x3C3C3C7CDC3C0000, 0xF8F8FFFFDCFCFCF8, 0xF0F0FEFED8F8F000,
+    0xE0E0FCFCD0E00000, 0xC0C0F8F8C0000000, 0x0088F8F800000000, 0x1818F8F818000000, 0x3C3CFCFC5C3C0000, 0xF8FCFCF0B0F0F8F0, 0xF0F8F8E0A0E0E000, 0x00F0F0C080C0E000,
+    0x0000E08080800000, 0x0000F03030300000, 0xF8F8F0F0B0F8F8F0, 0xF0F0E0E0A0F0E000, 0x00E0C0C080C00000, 0xF8F0F0F0B8F8F8F0, 0xF0E0E0E0B0F0E000, 0xE0C0C0C0A0C00000,
+    0x0080808080000000, 0x0030303030000000, 0xF0F0F0FABEF8F8F0, 0xE0E0E0F4BCF0E000, 0xC0C0C0E8B8C00000, 0x808080D0B0000000, 0x000000A0A0000000, 0x30303070B0000000,
+    0xF0F0FEFEB8F8F8F0, 0xE0E0FCFCB0F0E000, 0xC0C0F8F8A0C00000, 0x8080F0F080000000, 0x0010F0F000000000, 0x3030F0F030000000, 0xF0F8F8E060E00000, 0xE0F0F0C040C00000,
+    0x00E0E08000000000, 0x0000C00000000000, 0xF0F0E0E060000000, 0xE0E0C0C040000000, 0x0040000000000000, 0xF0E0E0E000000000, 0xE0C0C0C000000000, 0xE0E0E0F000000000,
+    0xC0C0C00000000000, 0xE0E0F0F000000000, 0xC0C0E00000000000, 0xFEFEF8E8F8F80000, 0xFCFCF0E0F0F80000, 0x0078606060000000, 0x003C0C0C0C000000, 0x7E7E1E0E1E3E0000,
+    0xFFFF3F2F3F3F0000, 0xFCF8F8E8FCF80000, 0xF8F0F0E0F0000000, 0x3E1E1E0E1E000000, 0x7F3F3F2F7F3F0000, 0xF8F8F8EEFEF80000, 0xF0F0F0ECF0000000, 0x6060606000000000,
+    0x0C0C0C0C00000000, 0x1E1E1E6E1E000000, 0x3F3F3FEFFF3F0000, 0xF8F8FFEFFEF80000, 0xF0F0FEEEF0000000, 0x60607C6C00000000, 0x00447C6C00000000, 0x0C0C7C6C00000000,
+    0x1E1EFEEE1E000000, 0x3F3FFFEFFF3F0000, 0xFCFCF0D0F0F00000, 0xF8F8E0C0E0F00000, 0x00F0C0C0C0000000, 0x0078181818000000, 0xFCFC3C1C3C7C0000, 0xF8F0F0D0F8F00000,
+    0xF0E0E0C0E0000000, 0x7C3C3C1C3C000000, 0xF0F0F0DCFCF00000, 0xE0E0E0D8E0000000, 0xC0C0C0C000000000, 0x1818181800000000, 0x3C3C3CDC3C000000, 0xF0F0FEDEFCF00000,
+    0xE0E0FCDCE0000000, 0xC0C0F8D800000000, 0x0088F8D800000000, 0x1818F8D800000000, 0x3C3CFCDC3C000000, 0xF8F8E0A0E0E00000, 0xF0F0C080C0E00000, 0x00E0808080000000,
+    0x00F0303030000000, 0xF0E0E0A0F0E00000, 0xE0C0C080C0000000, 0xE0E0E0B8F8E00000, 0xC0C0C0B0C0000000, 0x8080808000000000, 0x3030303000000000, 0xE0E0FCBCF8E00000,
+    0xC0C0F8B8C0000000, 0x8080F0B000000000, 0x0010F0B000000000, 0x3030F0B000000000, 0xF0F0C040C0000000, 0xE0E0800000000000, 0x00C0000000000000, 0xE0C0C04000000000,
+    0x4000000000000000, 0xC0C0C00000000000, 0xC0C0E00000000000, 0xFCF0E0F0F8000000, 0x7860606000000000, 0x3C0C0C0C00000000, 0x7E1E0E1E3E000000, 0xF0F0E0FEFE000000,
+    0x1E1E0EFEFE000000, 0xF0F0EEFEFE000000, 0x6060647C00000000, 0x0000280000000000, 0x0C0C4C7C00000000, 0x1E1EEEFEFE000000, 0xF8E0C0E0F0000000, 0xF0C0C0C000000000,
+    0x7818181800000000, 0xFC3C1C3C7C000000, 0xE0E0C0FCFC000000, 0x3C3C1CFCFC000000, 0xE0E0DCFCFC000000, 0xC0C0C8F800000000, 0x0000500000000000, 0x181898F800000000,
+    0x3C3CDCFCFC000000, 0xF0C080C0E0000000, 0xE080808000000000, 0xF030303000000000, 0xC0C080F8F8000000, 0xC0C0B8F8F8000000, 0x808090F000000000, 0x0000A00000000000,
+    0x203010F000000000, 0xE080000000000000, 0x4000000000000000, 0x0000600000000000, 0x6060600000000000, 0x0C0C0C0000000000, 0x0044547C00000000, 0xC0C0C00000000000,
+    0x1818180000000000, 0x3F1F3F7FFFFFFFFF, 0x0088A8F800000000, 0xFF3F3F3F3FFFFFFF, 0x8080800000000000, 0x3030300000000000, 0x001050F000000000, 0x0F0F8FFFFFFFFFFF,
+    0x0F0FFFFFFFFFFFFF, 0x0000000000382020, 0x0000000000380000, 0x0000000000380808, 0x00FCFFFFFFFCECFC, 0x0000FEFEFEF8E8F0, 0x0000FEFEFEF0E0F0, 0x0000000000202000,
+    0x0000000000080800, 0x0000FEFEFE1E0E1E, 0x0000FEFEFE3E2E1E, 0x00FCFCFFFCFCECFC, 0x0000F8FEF8F8E8F0, 0x0000007C70706000, 0x0000000000200000, 0x0000000000080000,
+    0x0000007C1C1C0C00, 0x00003EFE3E3E2E1E, 0x00FCFCFCFCFCECFC, 0x0000F8F8F8F8E8F0, 0x0000007070706000, 0x0000000020200000, 0x0000000008080000, 0x0000001C1C1C0C00,
+    0x00003E3E3E3E2E1E, 0x00FCFCFCFCFDECFC, 0x0000F8F8F8FAE8F0, 0x0000007070746000, 0x0000002020280000, 0x0000000000100000, 0x0000000808280000, 0x0000001C1C5C0C00,
+    0x00003E3E3EBE2E1E, 0x00FCFCFCFFFCECFC, 0x0000F8F8FEF8E8F0, 0x000070707C706000, 0x0000202038200000, 0x0000000038000000, 0x0000080838080000, 0x00001C1C7C1C0C00,
+    0x00003E3EFE3E2E1E, 0x00FCFCFFFFFFECFC, 0x00F8F8FEFEFEE8F0, 0x0070707C7C7C6000, 0x0020207C7C7C0000, 0x0000007C7C7C0000, 0x0008087C7C7C0000, 0x001C1C7C7C7C0C00,
+    0x003E3EFEFEFE2E1E, 0xFCFCFFFFFFFFEFFC, 0xF8F8FEFEFEFEEEF0, 0x7070FEFEFEFEEE00, 0x2020FEFEFEFEEE00, 0x0000FEFEFEFEEE00, 0x0808FEFEFEFEEE00, 0x1C1CFEFEFEFEEE00,
+    0x3E3EFEFEFEFEEE1E, 0x0000000000704040, 0x0000000000700000, 0x0000000000701010, 0xFCFCFFFFFFFCDCFC, 0x00F8FEFEFEF8D8F8, 0x0000FCFCFCF0D0E0, 0x0000FCFCFCE0C0E0,
+    0x0000000000404000, 0x0000000000101000, 0x0000FCFCFC3C1C3C, 0xFCFCFCFFFCFCDCFC, 0x00F8F8FEF8F8D8F8, 0x0000F0FCF0F0D0E0, 0x000000F8E0E0C000, 0x0000000000400000,
+    0x0000000000100000, 0x000000F838381800, 0xFCFCFCFCFCFCDCFC, 0x00F8F8F8F8F8D8F8, 0x0000F0F0F0F0D0E0, 0x000000E0E0E0C000, 0x0000000040400000, 0x0000000010100000,
+    0x0000003838381800, 0xFCFCFCFCFCFDDCFC, 0x00F8F8F8F8FAD8F8, 0x0000F0F0F0F4D0E0, 0x000000E0E0E8C000, 0x0000004040500000, 0x0000000000200000, 0x0000001010500000,
+    0x0000003838B81800, 0xFCFCFCFCFFFCDCFC, 0x00F8F8F8FEF8D8F8, 0x0000F0F0FCF0D0E0, 0x0000E0E0F8E0C000, 0x0000404070400000, 0x0000000070000000, 0x0000101070100000,
+    0x00003838F8381800, 0xFCFCFCFFFFFFDCFC, 0x00F8F8FEFEFED8F8, 0x00F0F0FCFCFCD0E0, 0x00E0E0F8F8F8C000, 0x004040F8F8F80000, 0x000000F8F8F80000, 0x001010F8F8F80000,
+    0x003838F8F8F81800, 0xFCFCFFFFFFFFDFFC, 0xF8F8FEFEFEFEDEF8, 0xF0F0FCFCFCFCDCE0, 0xE0E0FCFCFCFCDC00, 0x4040FCFCFCFCDC00, 0x0000FCFCFCFCDC00, 0x1010FCFCFCFCDC00,
+    0x3838FCFCFCFCDC00, 0x0000000000E08080, 0x0000000000E00000, 0x0000000000E02020, 0xFCFCFFFFFFFCBCFC, 0xF8F8FEFEFEF8B8F8, 0x00F0FCFCFCF0B0F0, 0x0000F8F8F8E0A0C0,
+    0x0000F8F8F8C080C0, 0x0000000000808000, 0x0000000000202000, 0xFCFCFCFFFCFCBCFC, 0xF8F8F8FEF8F8B8F8, 0x00F0F0FCF0F0B0F0, 0x0000E0F8E0E0A0C0, 0x000000F0C0C08000,
+    0x0000000000800000, 0x0000000000200000, 0xFCFCFCFCFCFCBCFC, 0xF8F8F8F8F8F8B8F8, 0x00F0F0F0F0F0B0F0, 0x0000E0E0E0E0A0C0, 0x000000C0C0C08000, 0x0000000080800000,
+    0x0000000020200000, 0xFCFCFCFCFCFDBCFC, 0xF8F8F8F8F8FAB8F8, 0x00F0F0F0F0F4B0F0, 0x0000E0E0E0E8A0C0, 0x000000C0C0D08000, 0x0000008080A00000, 0x0000000000400000,
+    0x0000002020A00000, 0xFCFCFCFCFFFDBCFC, 0xF8F8F8F8FEF8B8F8, 0x00F0F0F0FCF0B0F0, 0x0000E0E0F8E0A0C0, 0x0000C0C0F0C08000, 0x00008080E0800000, 0x00000000E0000000,
+    0x00002020E0200000, 0xFCFCFCFFFFFFBCFC, 0xF8F8F8FEFEFEB8F8, 0x00F0F0FCFCFCB0F0, 0x00E0E0F8F8F8A0C0, 0x00C0C0F0F0F08000, 0x008080F0F0F00000, 0x000000F0F0F00000,
+    0x002020F0F0F00000, 0xFCFCFFFFFFFFBFFC, 0xF8F8FEFEFEFEBEF8, 0xF0F0FCFCFCFCBCF0, 0xE0E0F8F8F8F8B8C0, 0xC0C0F8F8F8F8B800, 0x8080F8F8F8F8B800, 0x0000F8F8F8F8B800,
+    0x2020F8F8F8F8B800, 0x0000000000C00000, 0x0000000000C00000, 0xF8F8FEFEFEF87800, 0xF0F0FCFCFCF07000, 0x00E0F8F8F8E06000, 0x0000F0F0F0404000, 0x0000F0F0F0000000,
+    0xF8F8F8FEF8F80000, 0xF0F0F0FCF0F00000, 0x00E0E0F8E0E00000, 0x0000407040400000, 0x0000006000000000, 0xF8F8F8F8F8000000, 0xF0F0F0F0F0000000, 0x00E0E0E0E0000000,
+    0x0000404040000000, 0xF8F8F8F8F8000000, 0xF0F0F0F000000000, 0x00E0E0E000000000, 0x0000404000000000, 0xF8F8F8F8F8000000, 0xF0F0F0F000000000, 0x00E0E00000000000,
+    0x0000400000000000, 0xF8F8F8F8F8000000, 0xF0F0F0F000000000, 0x00E0E00000000000, 0x0040000000000000, 0xF8F8F8F8F8000000, 0xF0F0F0F000000000, 0xE0E0E00000000000,
+    0x4040000000000000, 0x00FCFEFEFFECFCF8, 0x0000FCFCFEE8F8F8, 0x000000787C607000, 0x0000000038202000, 0x0000000038000000, 0x0000000038080800, 0x0000003C7C0C1C00,
+    0x00007E7EFE2E3E3E, 0x00FCFCFEFCECFCF8, 0x0000F8FCF8E8F000, 0x0000007870607000, 0x0000000020200000, 0x0000000008080000, 0x0000003C1C0C1C00, 0x00003E7E3E2E1E00,
+    0x00FCFCFCFCECFCF8, 0x0000F8F8F8E8F000, 0x0000007070600000, 0x0000000020000000, 0x0000000008000000, 0x0000001C1C0C0000, 0x00003E3E3E2E1E00, 0x00FCFCFCFCECFCF8,
+    0x0000F8F8F8E8F000, 0x0000707070600000, 0x0000002020000000, 0x0000000808000000, 0x00001C1C1C0C0000, 0x00003E3E3E2E1E00, 0x00FCFCFCFDECFCF8, 0x00F8F8F8FAE8F000,
+    0x0000707074600000, 0x0000202028000000, 0x0000000010000000, 0x0000080828000000, 0x00001C1C5C0C0000, 0x003E3E3EBE2E1E00, 0xFCFCFCFFFCECFCF8, 0x00F8F8FEF8E8F000,
+    0x0070707C70600000, 0x0020203820000000, 0x0000003800000000, 0x0008083808000000, 0x001C1C7C1C0C0000, 0x003E3EFE3E2E1E00, 0xFCFCFFFFFFECFCF8, 0xF8F8FEFEFEE8F000,
+    0x70707C7C7C600000, 0x20207C7C7C000000, 0x00007C7C7C000000, 0x08087C7C7C000000, 0x1C1C7C7C7C0C0000, 0x3E3EFEFEFE2E1E00, 0xFCFCFEFEFFDCFCFC, 0x00F8FCFCFED8F8F0,
+    0x0000F8F8FCD0F0F0, 0x000000F0F8C0E000, 0x0000000070404000, 0x0000000070000000, 0x0000000070101000, 0x00000078F8183800, 0xFCFCFCFEFCDCFCFC, 0x00F8F8FCF8D8F8F0,
+    0x0000F0F8F0D0E000, 0x000000F0E0C0E000, 0x0000000040400000, 0x0000000010100000, 0x0000007838183800, 0xFCFCFCFCFCDCFCFC, 0x00F8F8F8F8D8F8F0, 0x0000F0F0F0D0E000,
+    0x000000E0E0C00000, 0x0000000040000000, 0x0000000010000000, 0x0000003838180000, 0xFCFCFCFCFCDCFCFC, 0x00F8F8F8F8D8F8F0, 0x0000F0F0F0D0E000, 0x0000E0E0E0C00000,
+    0x0000004040000000, 0x0000001010000000, 0x0000383838180000, 0xFCFCFCFCFDDCFCFC, 0x00F8F8F8FAD8F8F0, 0x00F0F0F0F4D0E000, 0x0000E0E0E8C00000, 0x0000404050000000,
+    0x0000000020000000, 0x0000101050000000, 0x00003838B8180000, 0xFCFCFCFFFCDCFCFC, 0xF8F8F8FEF8D8F8F0, 0x00F0F0FCF0D0E000, 0x00E0E0F8E0C00000, 0x0040407040000000,
+    0x0000007000000000, 0x0010107010000000, 0x003838F838180000, 0xFCFCFFFFFFDCFCFC, 0xF8F8FEFEFED8F8F0, 0xF0F0FCFCFCD0E000, 0xE0E0F8F8F8C00000, 0x4040F8F8F8000000,
+    0x0000F8F8F8000000, 0x1010F8F8F8000000, 0x3838F8F8F8180000, 0xFCFCFEFEFFBCFCFC, 0xF8F8FCFCFEB8F8F8, 0x00F0F8F8FCB0F0E0, 0x0000F0F0F8A0E0E0, 0x000000E0F080C000,
+    0x00000000E0808000, 0x00000000E0000000, 0x00000000E0202000, 0xFCFCFCFEFCBCFCFC, 0xF8F8F8FCF8B8F8F8, 0x00F0F0F8F0B0F0E0, 0x0000E0F0E0A0C000, 0x000000E0C080C000,
+    0x0000000080800000, 0x0000000020200000, 0xFCFCFCFCFCBCFCFC, 0xF8F8F8F8F8B8F8F8, 0x00F0F0F0F0B0F0E0, 0x0000E0E0E0A0C000, 0x000000C0C0800000, 0x0000000080000000,
+    0x0000000020000000, 0xFCFCFCFCFCBCFCFC, 0xF8F8F8F8F8B8F8F8, 0x00F0F0F0F0B0F0E0, 0x0000E0E0E0A0C000, 0x0000C0C0C0800000, 0x0000008080000000, 0x0000002020000000,
+    0xFCFCFCFCFDBCFCFC, 0xF8F8F8F8FAB8F8F8, 0x00F0F0F0F4B0F0E0, 0x00E0E0E0E8A0C000, 0x0000C0C0D0800000, 0x00008080A0000000, 0x0000000040000000, 0x00002020A0000000,
+    0xFCFCFCFFFDBCFCFC, 0xF8F8F8FEF8B8F8F8, 0xF0F0F0FCF0B0F0E0, 0x00E0E0F8E0A0C000, 0x00C0C0F0C0800000, 0x008080E080000000, 0x000000E000000000, 0x002020E020000000,
+    0xFCFCFFFFFFBCFCFC, 0xF8F8FEFEFEB8F8F8, 0xF0F0FCFCFCB0F0E0, 0xE0E0F8F8F8A0C000, 0xC0C0F0F0F0800000, 0x8080F0F0F0000000, 0x0000F0F0F0000000, 0x2020F0F0F0000000,
+    0xF8F8FCFCFE78F800, 0xF0F0F8F8FC70F000, 0x00E0F0F0F860E000, 0x0000E0E0F0404000, 0x000000C0E0000000, 0x00000000C0000000, 0x00000000C0000000, 0xF8F8F8FCF8780000,
+    0xF0F0F0F8F0700000, 0x00E0E0F0E0600000, 0x0000406040400000, 0x0000004000000000, 0xF8F8F8F8F8000000, 0xF0F0F0F0F0000000, 0x00E0E0E0E0000000, 0x0000404040000000,
+    0xF8F8F8F8F8000000, 0xF0F0F0F000000000, 0x00E0E0E000000000, 0x0000404000000000, 0xF8F8F8F8F8000000, 0xF0F0F0F000000000, 0x00E0E00000000000, 0x0000400000000000,
+    0xF8F8F8F8F8000000, 0xF0F0F0F000000000, 0x00E0E00000000000, 0x0040000000000000, 0xF8F8F8F8F8000000, 0xF0F0F0F000000000, 0xE0E0E00000000000, 0x4040000000000000,
+    0xFCFEFEFFECFCF800, 0x00FCFCFEE8F8F800, 0x0000787C60700000, 0x0000003820200000, 0x0000003800000000, 0x0000003808080000, 0x00003C7C0C1C0000, 0x007E7EFE2E3E3E00,
+    0xFCFCFEFCECFCF800, 0x00F8FCF8E8F00000, 0x0000787060700000, 0x0000002020000000, 0x0000000808000000, 0x00003C1C0C1C0000, 0x003E7E3E2E1E0000, 0xFCFCFCFCECFCF800,
+    0x00F8F8F8E8F00000, 0x0000707060000000, 0x0000002000000000, 0x0000000800000000, 0x00001C1C0C000000, 0x003E3E3E2E1E0000, 0xFCFCFCFCECFCF800, 0x00F8F8F8E8F00000,
+    0x0070707060000000, 0x0000202000000000, 0x0000080800000000, 0x001C1C1C0C000000, 0x003E3E3E2E1E0000, 0xFCFCFCFDECFCF800, 0xF8F8F8FAE8F00000, 0x0070707460000000,
+    0x0020202800000000, 0x0000001000000000, 0x0008082800000000, 0x001C1C5C0C000000, 0x3E3E3EBE2E1E0000, 0xFCFCFFFCECFCF800, 0xF8F8FEF8E8F00000, 0x70707C7060000000,
+    0x2020382000000000, 0x0000380000000000, 0x0808380800000000, 0x1C1C7C1C0C000000, 0x3E3EFE3E2E1E0000, 0xFCFEFEFFDCFCFCF8, 0xF8FCFCFED8F8F000, 0x00F8F8FCD0F0F000,
+    0x0000F0F8C0E00000, 0x0000007040400000, 0x0000007000000000, 0x0000007010100000, 0x000078F818380000, 0xFCFCFEFCDCFCFCF8, 0xF8F8FCF8D8F8F000, 0x00F0F8F0D0E00000,
+    0x0000F0E0C0E00000, 0x0000004040000000, 0x0000001010000000, 0x0000783818380000, 0xFCFCFCFCDCFCFCF8, 0xF8F8F8F8D8F8F000, 0x00F0F0F0D0E00000, 0x0000E0E0C0000000,
+    0x0000004000000000, 0x0000001000000000, 0x0000383818000000, 0xFCFCFCFCDCFCFCF8, 0xF8F8F8F8D8F8F000, 0x00F0F0F0D0E00000, 0x00E0E0E0C0000000, 0x0000404000000000,
+    0x0000101000000000, 0x0038383818000000, 0xFCFCFCFDDCFCFCF8, 0xF8F8F8FAD8F8F000, 0xF0F0F0F4D0E00000, 0x00E0E0E8C0000000, 0x0040405000000000, 0x0000002000000000,
+    0x0010105000000000, 0x003838B818000000, 0xFCFCFFFDDCFCFCF8, 0xF8F8FEF8D8F8F000, 0xF0F0FCF0D0E00000, 0xE0E0F8E0C0000000, 0x4040704000000000, 0x0000700000000000,
+    0x1010701000000000, 0x3838F83818000000, 0xF8FCFCFEB8F8F8F0, 0xF0F8F8FCB0F0E000, 0x00F0F0F8A0E0E000, 0x0000E0F080C00000, 0x000000E080800000, 0x000000E000000000,
+    0x000000E020200000, 0xF8F8FCF8B8F8F8F0, 0xF0F0F8F0B0F0E000, 0x00E0F0E0A0C00000, 0x0000E0C080C00000, 0x0000008080000000, 0x0000002020000000, 0xF8F8F8F8B8F8F8F0,
+    0xF0F0F0F0B0F0E000, 0x00E0E0E0A0C00000, 0x0000C0C080000000, 0x0000008000000000, 0x0000002000000000, 0xF8F8F8F8B8F8F8F0, 0xF0F0F0F0B0F0E000, 0x00E0E0E0A0C00000,
+    0x00C0C0C080000000, 0x0000808000000000, 0x0000202000000000, 0xF8F8F8FAB8F8F8F0, 0xF0F0F0F4B0F0E000, 0xE0E0E0E8A0C00000, 0x00C0C0D080000000, 0x008080A000000000,
+    0x0000004000000000, 0x002020A000000000, 0xF8F8FEFAB8F8F8F0, 0xF0F0FCF0B0F0E000, 0xE0E0F8E0A0C00000, 0xC0C0F0C080000000, 0x8080E08000000000, 0x0000E00000000000,
+    0x2020E02000000000, 0xF0F8F8FC70F00000, 0xE0F0F0F860E00000, 0x00E0E0F040400000, 0x0000C0E000000000, 0x000000C000000000, 0x000000C000000000, 0xF0F0F8F070000000,
+    0xE0E0F0E060000000, 0x0040604040000000, 0x0000400000000000, 0xF0F0F0F000000000, 0xE0E0E0E000000000, 0x0040404000000000, 0xF0F0F0F000000000, 0xE0E0E00000000000,
+    0x0040400000000000, 0xF0F0F0F000000000, 0xE0E0E00000000000, 0x0040000000000000, 0xF0F0F0F000000000, 0xE0E0E00000000000, 0x4040000000000000, 0xFEFEFFECFCF80000,
+    0xFCFCFEE8F8F80000, 0x00787C6070000000, 0x0000382020000000, 0x0000380000000000, 0x0000380808000000, 0x003C7C0C1C000000, 0x7E7EFE2E3E3E0000, 0xFCFEFCECFCF80000,
+    0xF8FCF8E8F0000000, 0x0078706070000000, 0x0000202000000000, 0x0000080800000000, 0x003C1C0C1C000000, 0x3E7E3E2E1E000000, 0xFCFCFCECFCF80000, 0xF8F8F8E8F0000000,
+    0x0070706000000000, 0x0000200000000000, 0x0000080000000000, 0x001C1C0C00000000, 0x3E3E3E2E1E000000, 0xFCFCFCEEFCF80000, 0xF8F8F8ECF0000000, 0x7070706000000000,
+    0x0020200000000000, 0x0008080000000000, 0x1C1C1C0C00000000, 0x3E3E3E6E1E000000, 0xFCFCFFEEFEF80000, 0xF8F8FEECF0000000, 0x70707C6000000000, 0x2020380000000000,
+    0x0000380000000000, 0x0808380000000000, 0x1C1C7C0C00000000, 0x3E3EFE6E1E000000, 0xFCFCFED8F8F00000, 0xF8F8FCD0F0F00000, 0x00F0F8C0E0000000, 0x0000704040000000,
+    0x0000700000000000, 0x0000701010000000, 0x0078F81838000000, 0xF8FCF8D8F8F00000, 0xF0F8F0D0E0000000, 0x00F0E0C0E0000000, 0x0000404000000000, 0x0000101000000000,
+    0x0078381838000000, 0xF8F8F8D8F8F00000, 0xF0F0F0D0E0000000, 0x00E0E0C000000000, 0x0000400000000000, 0x0000100000000000, 0x0038381800000000, 0xF8F8F8DCF8F00000,
+    0xF0F0F0D8E0000000, 0xE0E0E0C000000000, 0x0040400000000000, 0x0010100000000000, 0x3838381800000000, 0xF8F8FEDCFCF00000, 0xF0F0FCD8E0000000, 0xE0E0F8C000000000,
+    0x4040700000000000, 0x0000700000000000, 0x1010700000000000, 0x3838F81800000000, 0xF8F8FCB0F0E00000, 0xF0F0F8A0E0E00000, 0x00E0F080C0000000, 0x0000E08080000000,
+    0x0000E00000000000, 0x0000E02020000000, 0xF0F8F0B0F0E00000, 0xE0F0E0A0C0000000, 0x00E0C080C0000000, 0x0000808000000000, 0x0000202000000000, 0xF0F0F0B0F0E00000,
+    0xE0E0E0A0C0000000, 0x00C0C08000000000, 0x0000800000000000, 0x0000200000000000, 0xF0F0F0B8F0E00000, 0xE0E0E0B0C0000000, 0xC0C0C08000000000, 0x0080800000000000,
+    0x0020200000000000, 0xF0F0FCB8F8E00000, 0xE0E0F8B0C0000000, 0xC0C0F08000000000, 0x8080E00000000000, 0x0000E00000000000, 0x2020E00000000000, 0xF0F0F860E0000000,
+    0xE0E0F04040000000, 0x00C0E00000000000, 0x0000C00000000000, 0x0000C00000000000, 0xE0F0E06000000000, 0x4060404000000000, 0x0040000000000000, 0xE0E0E00000000000,
+    0x4040400000000000, 0xE0E0E00000000000, 0x4040000000000000, 0xE0E0E00000000000, 0x4040000000000000, 0xFCFEE8F8F8000000, 0x787C607000000000, 0x0038202000000000,
+    0x0038000000000000, 0x0038080800000000, 0x3C7C0C1C00000000, 0x7EFE2E3E3E000000, 0xFCF8E8F8F8000000, 0x7870607000000000, 0x0020200000000000, 0x0008080000000000,
+    0x3C1C0C1C00000000, 0x7E3E2E3E3E000000, 0xF8F8E8FEF8000000, 0x7070607C00000000, 0x0020200000000000, 0x0008080000000000, 0x1C1C0C7C00000000, 0x3E3E2EFE3E000000,
+    0xF8F8EEFEFE000000, 0x7070647C00000000, 0x2020280000000000, 0x0808280000000000, 0x1C1C4C7C00000000, 0x3E3EEEFEFE000000, 0xF8FCD0F0F0000000, 0xF0F8C0E000000000,
+    0x0070404000000000, 0x0070000000000000, 0x0070101000000000, 0x78F8183800000000, 0xF8F0D0F0F0000000, 0xF0E0C0E000000000, 0x0040400000000000, 0x0010100000000000,
+    0x7838183800000000, 0xF0F0D0FCF0000000, 0xE0E0C0F800000000, 0x0040400000000000, 0x0010100000000000, 0x383818F800000000, 0xF0F0DCFCFC000000, 0xE0E0C8F800000000,
+    0x4040500000000000, 0x1010500000000000, 0x383898F800000000, 0xF0F8A0E0E0000000, 0xE0F080C000000000, 0x00E0808000000000, 0x00E0000000000000, 0x00E0202000000000,
+    0xF0E0A0E0E0000000, 0xE0C080C000000000, 0x0080800000000000, 0x0020200000000000, 0xE0E0A0F8E0000000, 0xC0C080F000000000, 0x0080800000000000, 0x0020000000000000,
+    0xE0E0B8F8F8000000, 0xC0C090F000000000, 0x8080A00000000000, 0x0000A00000000000, 0xE0F0404000000000, 0x40E0000000000000, 0x00C0000000000000, 0x00C0000000000000,
+    0x6040400000000000, 0x4000000000000000, 0x4040400000000000, 0x4040600000000000, 0x7C60700000000000, 0x3820200000000000, 0x3800000000000000, 0x3808080000000000,
+    0x7C0C1C0000000000, 0x7060700000000000, 0x2020000000000000, 0x0808000000000000, 0x1C0C1C0000000000, 0x70607C0000000000, 0x2020100000000000, 0x0000280000000000,
+    0x0808100000000000, 0x1C0C7C0000000000, 0xF8C0E00000000000, 0x7040400000000000, 0x7000000000000000, 0x7010100000000000, 0xF818380000000000, 0xE0C0E00000000000,
+    0x4040000000000000, 0x1010000000000000, 0x3818380000000000, 0xE0C0F80000000000, 0x4040200000000000, 0x0000500000000000, 0x1010200000000000, 0x3818380000000000,
+    0xF080C00000000000, 0xE080800000000000, 0xE000000000000000, 0xE020200000000000, 0xC080C00000000000, 0x8080000000000000, 0x2020000000000000, 0xC080F00000000000,
+    0x8080400000000000, 0x0000A00000000000, 0x2020400000000000, 0x7F47C7C7FFFFFFFF, 0x6000800000000000, 0x4000000000000000, 0xC000000000000000, 0x4747C7FFFFFFFFFF,
+    0x0000800000000000, 0x4747FFFFFFFFFFFF, 0x0000E00000000000};
+
+// KRK : 81920 positions, 226 blocs mixtes, 2208 octets
+static const uint32_t KRK_MIXTES[40] PROGMEM = {
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xC0300C07, 0x701C0701, 0x1C0701C0, 0x0F03C070,
+    0x03C0F03C, 0x81E0781E, 0xC0781E07, 0xF03C0701, 0x3C0F03C0, 0x1E0781E0, 0x0781E078, 0x03C0F03C,
+    0x80E03C0F, 0xE0781E03, 0x781E0781, 0x3C0F03C0, 0x0F03C0F0, 0x0380E038, 0x80E0380E, 0xC0300C03};
+
+static const uint32_t KRK_UNIFORMES[40] PROGMEM = {
+    0xFFEFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xEFFBFEFF, 0xFFFFFFFF, 0xFDFF7FDF, 0xFF7FDFF7, 0xFFFFF7FD, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFDFFFFFF, 0xFF7FDFF7, 0x7FDFF7FD, 0x3FCFF3F8, 0x8FE3F8FE, 0xE3F8FE3F, 0xF0FC3F8F,
+    0xFC3F0FC3, 0x7E1F87E1, 0x3F87E1F8, 0x0FC3F8FE, 0xC3F0FC3F, 0xE1F87E1F, 0xF87E1F87, 0xFC3F0FC3,
+    0x7F1FC3F0, 0x1F87E1FC, 0x87E1F87E, 0xC3F0FC3F, 0xF0FC3F0F, 0xFC7F1FC7, 0x7F1FC7F1, 0x3FCFF3FC};
+
+static const uint16_t KRK_RANGS[40] PROGMEM = {
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0013, 0x001C,
+    0x0027, 0x0033, 0x0040, 0x004D, 0x0059, 0x0065, 0x0071, 0x007D,
+    0x0089, 0x0095, 0x00A2, 0x00AF, 0x00BB, 0x00C7, 0x00D0, 0x00DA};
+
+static const uint64_t KRK_BLOCS[226] PROGMEM = {
+    0xCFB3ECF93E809000, 0xE8EA3C800000FB3E, 0x36CFB3ECFA3E8FA3, 0x8F23C8F004800000, 0xC8E21C820000F23C, 0x1E07810000000780, 0x816018020781E078, 0x3E4C0000012E4792,
+    0x0060192E0F93E4F9, 0xF13E4F93E4F93E4D, 0x700000093B3ED7B6, 0x0069397E9FB7EDFB, 0xF37EDFB7EDFB7001, 0x000048FDFFBFF7FE, 0x48EFFDFFBFFFFFC0, 0xF7FFFFFFFFC00001,
+    0x0003FFFDFFBFF7FE, 0xFFEFFDFFBFFF0000, 0xF7FFFFFF00000003, 0x0FFFFFFDFFBFF7FE, 0xFFEFFDFFBFFF0000, 0xF7FFFFFF00000FFF, 0xCFB3ECF93E809000, 0xECEB3CC29000FB3E,
+    0x36C28000FB3ECFB3, 0x8D2348D004800000, 0x48C214800000D234, 0x34000000D2348D23, 0x1806010000000600, 0x0100000006018060, 0x2000020180601806, 0x384C000001284612,
+    0x000001280E1384E1, 0x21084E1384E1384C, 0x4E1384E1384E0080, 0x700000092B3AD6B6, 0x0029297A9EB7ADEB, 0x237ADEB7ADEB7000, 0xDEB7ADEB700200A8, 0x000048FDFFBFF7FE,
+    0x48EFFDFFBFFFFFC0, 0xF7FFFFFFFFC00001, 0xFFFFFFC0000340BF, 0x0003FFFDFFBFF7FE, 0xFFEFFDFFBFFF0000, 0xF7FFFFFF00000003, 0xFFFF00000003FFBF, 0x0FFFFFFDFFBFF7FE,
+    0xFFEFFDFFBFFF0000, 0xF7FFFFFF00000FFF, 0xFFFF00000FFFFFBF, 0xEFEBFCF29C03FBFE, 0xF6F28000FBFEFFBF, 0x0000FBFEFFBFEFBB, 0xFBFEFFBFEF7BFEF2, 0x4FC3D4E01C03D3F4,
+    0xF4000000D3F4FD3F, 0x0000D3F4FD3F4F93, 0xD3F4FD3F4F53F000, 0x0F0300E01C0F03C0, 0x0000000F03C0F03C, 0x000F03C0F03C0F00, 0x03C0F03C0F000000, 0x080301E03C1F07C1,
+    0x01007C1F07C1F07C, 0x7C1F07C1F07C0000, 0x07C1F07C00000000, 0x082B09F2BCBF2FCB, 0x03F2FCBF2FCBF000, 0xFCBF2FCBF0000028, 0x2FCBF00000200BF2, 0x48EFFDFFBFFFFFFF,
+    0xF7FFFFFFFFC00001, 0xFFFFFFC0000340BF, 0xFFC00003007FFFFF, 0xF7FFFFFF00000003, 0xFFFF00000003FFBF, 0x00000003FF7FFFFF, 0xF7FFFFFF00000FFF, 0xFFFF00000FFFFFBF,
+    0x00000FFFFF7FFFFF, 0xF7F2C010FFFFFFFF, 0x0000FFFFFFFFFFBF, 0xFFFFFFFFFF7FFFF2, 0xFFFFFFFFFFF00000, 0xF700C010DFF7FDFF, 0x0000DFF7FDFF7F9F, 0xDFF7FDFF7F5FF000,
+    0xFDFF7FDFE0000000, 0x0700C07F1FC7F1FC, 0x007F1FC7F1FC7F18, 0x1FC7F1FC7F000000, 0xF1FC7F000000007F, 0x0701FC7F1FC7F1FC, 0xFC7F1FC7F1FC4018, 0x1FC7F1FC00000001,
+    0xF1FC00000001FC7F, 0x07F3FCFF3FCFF3FC, 0xFCFF3FCFF0004038, 0x3FCFF00000200FF3, 0xF00000000FF3FCFF, 0xFFFFFFC0000340BF, 0xFFC00003007FFFFF, 0x000200FFFFFFFFFF,
+    0xFFFFFFFFFFFFFFC0, 0xFFFF00000003FFBF, 0x00000003FF7FFFFF, 0x0003FFFFFFFFFFFF, 0xFFFFFFFFFFFF0000, 0xFFFF00000FFFFFBF, 0x00000FFFFF7FFFFF, 0x0FFFFFFFFFFFFFFF,
+    0xFFFFFFFFFFFF0000, 0x0000FFFFFFFFFFBF, 0xFFFFFFFFFF7FFFF2, 0xFFFFFFFFFFF00000, 0xFFFFFFF00000FFFF, 0x0000FFFFFFFFFFBF, 0xFFFFFFFFFF7FF802, 0xFFFFFFFFE0000000,
+    0xFFFFC0000000FFFF, 0x01FF7FDFF7FDFF3F, 0x7FDFF7FDFF601802, 0xF7FDFF00000001FF, 0xFF00000001FF7FDF, 0x7FDFF7FD00601807, 0xF7FC00000007FDFF, 0x00000007FDFF7FDF,
+    0xDFF7FDFF7FDFF7FC, 0x7FDFF00100601FF7, 0xF00000001FF7FDFF, 0x00001FF7FDFF7FDF, 0xDFF7FDFF7FDFF000, 0xFFC00003007FFFFF, 0x000200FFFFFFFFFF, 0x00FFFFFFFFFFFFC0,
+    0xFFFFFFFFFFC00000, 0x00000003FF7FFFFF, 0x0003FFFFFFFFFFFF, 0xFFFFFFFFFFFF0000, 0xFFFFFFFF00000003, 0x00000FFFFF7FFFFF, 0x0FFFFFFFFFFFFFFF, 0xFFFFFFFFFFFF0000,
+    0xFFFFFFFF00000FFF, 0xFFFFFFFFFFF00000, 0xFFFFFFF00000FFFF, 0xFFF00000FFFFFFFF, 0xFFFFFFFFE0000000, 0xFFFFC0000000FFFF, 0xC0000000FFFFFFFF, 0xFFFFFF80200003FF,
+    0xFF00000003FFFFFF, 0x000003FFFFFFFFFF, 0xFFFFFFFFFFFFFF00, 0xFFFE0080200FFFFF, 0x0000000FFFFFFFFF, 0x000FFFFFFFFFFFFC, 0xFFFFFFFFFFFC0000, 0xF00200803FFFFFFF,
+    0x00003FFFFFFFFFFF, 0x3FFFFFFFFFFFF000, 0xFFFFFFFFF0000000, 0x000200FFFFFFFFFF, 0x00FFFFFFFFFFFFC0, 0xFFFFFFFFFFC00000, 0xFFFFFFC0000000FF, 0x0003FFFFFFFFFFFF,
+    0xFFFFFFFFFFFF0000, 0xFFFFFFFF00000003, 0xFFFF00000003FFFF, 0x0FFFFFFFFFFFFFFF, 0xFFFFFFFFFFFF0000, 0xFFFFFFFF00000FFF, 0xFFFF00000FFFFFFF, 0xFFFFFFF00000FFFF,
+    0xFFF00000FFFFFFFF, 0x0000FFFFFFFFFFFF, 0xFFFFFFFFFFFFFFF0, 0xFFFFC0000000FFFF, 0xC0000000FFFFFFFF, 0x0000FFFFFFFFFFFF, 0xFFFFFFFFFFFFC000, 0xFF00000003FFFFFF,
+    0x000003FFFFFFFFFF, 0x03FFFFFFFFFFFF00, 0xFFFFFFFFFF000000, 0x0000000FFFFFFFFF, 0x000FFFFFFFFFFFFC, 0xFFFFFFFFFFFC0000, 0xFFFFFFFC0000000F, 0x00003FFFFFFFFFFF,
+    0x3FFFFFFFFFFFF000, 0xFFFFFFFFF0000000, 0xFFFFF00000003FFF, 0x00FFFFFFFFFFFFFF, 0xFFFFFFFFFFC00000, 0xFFFFFFC0000000FF, 0xFFC0000000FFFFFF, 0xFFFFFFFF00000003,
+    0xFFFF00000003FFFF, 0x00000003FFFFFFFF, 0xFFFFFFFF00000FFF, 0xFFFF00000FFFFFFF, 0x00000FFFFFFFFFFF, 0xFFF00000FFFFFFFF, 0x0000FFFFFFFFFFFF, 0xFFFFFFFFFFFFFFF0,
+    0xC0000000FFFFFFFF, 0x0000FFFFFFFFFFFF, 0xFFFFFFFFFFFFC000, 0x000003FFFFFFFFFF, 0x03FFFFFFFFFFFF00, 0xFFFFFFFFFF000000, 0x000FFFFFFFFFFFFF, 0xFFFFFFFFFFFC0000,
+    0xFFFFFFFC0000000F, 0x3FFFFFFFFFFFFFFF, 0xFFFFFFFFF0000000, 0xFFFFF00000003FFF, 0xFFFFFFC0000000FF, 0xFFC0000000FFFFFF, 0xFFFF00000003FFFF, 0x00000003FFFFFFFF,
+    0xFFFF00000FFFFFFF, 0x00000FFFFFFFFFFF};
+
+// KQK : 81920 positions, 242 blocs mixtes, 2336 octets
+static const uint32_t KQK_MIXTES[40] PROGMEM = {
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xC0F01F77, 0x703C0F03, 0x1C0703C0, 0x0F03C070,
+    0x03C0F03C, 0x81E0783E, 0xC0781E07, 0xF07C0701, 0x3C0F03C0, 0x1E0781E0, 0x0781E078, 0x03C0F03C,
+    0x80E03C0F, 0xE0781E03, 0x781E0781, 0x3C0F03C0, 0x0F03C0F0, 0x03C0E038, 0x80E0380E, 0xE0300C03};
+
+static const uint32_t KQK_UNIFORMES[40] PROGMEM = {
+    0xFFEFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xEFFBFEFF, 0xFFFFFFFF, 0xFDFF7FDF, 0xFF7FDFF7, 0xFFFFF7FD, 0xFFFFFFFF, 0xEFFBFFFF, 0xFFFBFEFF,
+    0xFFFFFFFF, 0xFDFFFFFF, 0xFF7FDFF7, 0x7FDFF7FD, 0x3F0FE088, 0x8FC3F0FC, 0xE3F8FC3F, 0xF0FC3F8F,
+    0xFC3F0FC3, 0x7E1F87C1, 0x3F87E1F8, 0x0F83F8FE, 0xC3F0FC3F, 0xE1F87E1F, 0xF87E1F87, 0xFC3F0FC3,
+    0x7F1FC3F0, 0x1F87E1FC, 0x87E1F87E, 0xC3F0FC3F, 0xF0FC3F0F, 0xFC3F1FC7, 0x7F1FC7F1, 0x1FCFF3FC};
+
+static const uint16_t KQK_RANGS[40] PROGMEM = {
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0011, 0x001E, 0x0028,
+    0x0033, 0x003F, 0x004D, 0x005A, 0x0067, 0x0073, 0x007F, 0x008B,
+    0x0097, 0x00A3, 0x00B0, 0x00BD, 0x00C9, 0x00D5, 0x00DF, 0x00E9};
+
+static const uint64_t KQK_BLOCS[242] PROGMEM = {
+    0xCFB3ECF93E809000, 0xE8EA00029000FB3E, 0x36C003ECFA3E8FA3, 0xFB3ECFB3EC7B3C8F, 0xCFB3ECF23ECFB3EC, 0xC8FB3ECFB3ECFB3E, 0xB3ECFB3ECF23ECFB, 0xFB3C8FB3ECFB3ECF,
+    0x8F23C8F004800000, 0xC8E21C820000F23C, 0x348F2200F23C8F23, 0x1E07810000000780, 0x806018020781E078, 0x30180781E0781E07, 0x0781E0781E078180, 0x3E4C0000012E4792,
+    0x0060192E0F93E4F9, 0xE13E4F93E4F93E05, 0x4F93E4F93E4E01A4, 0x700000093B3ED7B6, 0x0069397E9FB7EDFB, 0xF37EDFB7EDF93001, 0xDFB7EDFB784FB7AD, 0x000048FDFFBFF7FE,
+    0x48EFFDFFBFFFFFC0, 0xF7FFFFFFEDC00001, 0xFFFFFFEB7FFFFFBF, 0x0003FFFDFFBFF7FE, 0xFFEFFDFFBFFF0000, 0xF7FFFFFF00000003, 0x0FFFFFFDFFBFF7FE, 0xFFEFFDFFBFFF0000,
+    0xF7FFFFFF00000003, 0xFFFFFFC00FFFFFBF, 0xCFB3ECF934809000, 0xECEB3CC29000FB3E, 0x34828000FB3ECFB3, 0x8D2348D004800000, 0x48C214800000D234, 0x34000000D2348D23,
+    0x1806010000000600, 0x0100000006018060, 0x2000020180601806, 0x384C000001284612, 0x000001280E1384E1, 0x21084E1384E1384C, 0x4E1384E1384E0080, 0x700000092B3AD6B6,
+    0x0029297A9EB7ADEB, 0x237ADEB7ADEB7000, 0xDEB7ADEB700200A8, 0x000048FDFFBFF7FE, 0x48EFFDFFBFFFFFC0, 0xF7FFFFFFFFC00001, 0xFFFFFFC0000340BF, 0x0003FFFDFFBFF7FE,
+    0xFFEFFDFFBFFF0000, 0xF7FFFFFF00000003, 0xFFFF00000003FFBF, 0x0FFFFFFDFFBFF7FE, 0xFFEFFDFFBFFF0000, 0xF7FFFFFF00000FFF, 0xFFFF00000FFFFFBF, 0xEFEBF4F29C03FBFE,
+    0xF6F28000FBFEFFBF, 0x0000FBFEFFBFEFBB, 0xFBFEFFBFEF7BF482, 0xFFBFEFFBFEFFB3EF, 0x4FC3D4E01C03D3F4, 0xF4000000D3F4FD3F, 0x0000D3F4FD3F4F93, 0xD3F4FD3F4F53F000,
+    0x0F0300E01C0F03C0, 0x0000000F03C0F03C, 0x000F03C0F03C0F00, 0x03C0F03C0F000000, 0x080301E03C1F07C1, 0x01007C1F07C1F07C, 0x7C1F07C1F07C0000, 0x07C1F07C00000000,
+    0x082B09F2BCBF2FCB, 0x03F2FCBF2FCBF000, 0xFCBF2FCBF0000028, 0x2FCBF00000200BF2, 0x48EFFDFFBFFFFFFF, 0xF7FFFFFFFFC00001, 0xFFFFFFC0000340BF, 0xFFC00003007FFFFF,
+    0xF7FFFFFF00000003, 0xFFFF00000003FFBF, 0x00000003FF7FFFFF, 0xF7FFFFFF00000FFF, 0xFFFF00000FFFFFBF, 0x00000FFFFF7FFFFF, 0xF7F2C010FFFFFFFF, 0x0000FFFFFFFFFFBF,
+    0xFFFFFFFFFF7FFFF2, 0xFFFFFFFFF4F00000, 0xFFFFFFFFBFFFFFFF, 0xF700C010DFF7FDFF, 0x0000DFF7FDFF7F9F, 0xDFF7FDFF7F5FF000, 0xFDFF7FDFE0000000, 0x0700C07F1FC7F1FC,
+    0x007F1FC7F1FC7F18, 0x1FC7F1FC7F000000, 0xF1FC7F000000007F, 0x0701FC7F1FC7F1FC, 0xFC7F1FC7F1FC4018, 0x1FC7F1FC00000001, 0xF1FC00000001FC7F, 0x07F3FCFF3FCFF3FC,
+    0xFCFF3FCFF0004038, 0x3FCFF00000200FF3, 0xF00000000FF3FCFF, 0xFFFFFFC0000340BF, 0xFFC00003007FFFFF, 0x000200FFFFFFFFFF, 0xFFFFFFFFFFFFFFC0, 0xFFFF00000003FFBF,
+    0x00000003FF7FFFFF, 0x0003FFFFFFFFFFFF, 0xFFFFFFFFFFFF0000, 0xFFFF00000FFFFFBF, 0x00000FFFFF7FFFFF, 0x0FFFFFFFFFFFFFFF, 0xFFFFFFFFFFFF0000, 0x0000FFFFFFFFFFBF,
+    0xFFFFFFFFFF7FFFF2, 0xFFFFFFFFFFF00000, 0xFFFFF7F00000FFFF, 0x0000FFFFFFFFFFBF, 0xFFFFFFFFFF7FF802, 0xFFFFFFFFE0000000, 0xFFFFC0000000FFFF, 0x01FF7FDFF7FDFF3F,
+    0x7FDFF7FDFF601802, 0xF7FDFF00000001FF, 0xFF00000001FF7FDF, 0x7FDFF7FD00601807, 0xF7FC00000007FDFF, 0x00000007FDFF7FDF, 0xDFF7FDFF7FDFF7FC, 0x7FDFF00100601FF7,
+    0xF00000001FF7FDFF, 0x00001FF7FDFF7FDF, 0xDFF7FDFF7FDFF000, 0xFFC00003007FFFFF, 0x000200FFFFFFFFFF, 0x00FFFFFFFFFFFFC0, 0xFFFFFFFFFFC00000, 0x00000003FF7FFFFF,
+    0x0003FFFFFFFFFFFF, 0xFFFFFFFFFFFF0000, 0xFFFFFFFF00000003, 0x00000FFFFF7FFFFF, 0x0FFFFFFFFFFFFFFF, 0xFFFFFFFFFFFF0000, 0xFFFFFFFF00000FFF, 0xFFFFFFFFFFF00000,
+    0xFFFFFFF00000FFFF, 0xFFF00000FFFFFFFF, 0xFFFFFFFFE0000000, 0xFFFFC0000000FFFF, 0xC0000000FFFFFFFF, 0xFFFFFF80200003FF, 0xFF00000003FFFFFF, 0x000003FFFFFFFFFF,
+    0xFFFFFFFFFFFFFF00, 0xFFFE0080200FFFFF, 0x0000000FFFFFFFFF, 0x000FFFFFFFFFFFFC, 0xFFFFFFFFFFFC0000, 0xF00200803FFFFFFF, 0x00003FFFFFFFFFFF, 0x3FFFFFFFFFFFF000,
+    0xFFFFFFFFF0000000, 0x000200FFFFFFFFFF, 0x00FFFFFFFFFFFFC0, 0xFFFFFFFFFFC00000, 0xFFFFFFC0000000FF, 0x0003FFFFFFFFFFFF, 0xFFFFFFFFFFFF0000, 0xFFFFFFFF00000003,
+    0xFFFF00000003FFFF, 0x0FFFFFFFFFFFFFFF, 0xFFFFFFFFFFFF0000, 0xFFFFFFFF00000FFF, 0xFFFF00000FFFFFFF, 0xFFFFFFF00000FFFF, 0xFFF00000FFFFFFFF, 0x0000FFFFFFFFFFFF,
+    0xFFFFFFFFFFFFFFF0, 0xFFFFC0000000FFFF, 0xC0000000FFFFFFFF, 0x0000FFFFFFFFFFFF, 0xFFFFFFFFFFFFC000, 0xFF00000003FFFFFF, 0x000003FFFFFFFFFF, 0x03FFFFFFFFFFFF00,
+    0xFFFFFFFFFF000000, 0x0000000FFFFFFFFF, 0x000FFFFFFFFFFFFC, 0xFFFFFFFFFFFC0000, 0xFFFFFFFC0000000F, 0x00003FFFFFFFFFFF, 0x3FFFFFFFFFFFF000, 0xFFFFFFFFF0000000,
+    0xFFFFF00000003FFF, 0x00FFFFFFFFFFFFFF, 0xFFFFFFFFFFC00000, 0xFFFFFFC0000000FF, 0xFFC0000000FFFFFF, 0xFFFFFFFF00000003, 0xFFFF00000003FFFF, 0x00000003FFFFFFFF,
+    0xFFFFFFFF00000FFF, 0xFFFF00000FFFFFFF, 0x00000FFFFFFFFFFF, 0xFFFFFFF003FFFFFF, 0xC0000000FFFFFFFF, 0x0000FFFFFFFFFFFF, 0xFFFFFFFFFFFFFFF0, 0xC0000000FFFFFFFF,
+    0x0000FFFFFFFFFFFF, 0xFFFFFFFFFFFFC000, 0x000003FFFFFFFFFF, 0x03FFFFFFFFFFFF00, 0xFFFFFFFFFF000000, 0x000FFFFFFFFFFFFF, 0xFFFFFFFFFFFC0000, 0xFFFFFFFC0000000F,
+    0x3FFFFFFFFFFFFFFF, 0xFFFFFFFFF0000000, 0xFFFFF00000003FFF, 0xFFFFFFC0000000FF, 0xFFC0000000FFFFFF, 0xFFFF00000003FFFF, 0x00000003FFFFFFFF, 0xFFFFFFFFFFC00FFF,
+    0xFFFF00000003FFFF, 0x00000FFFFFFFFFFF};
+
+static const TableFinale TABLES_FINALES[FINALE_AUCUNE] = {
+    {196608, KPK_MIXTES, KPK_UNIFORMES, KPK_RANGS, KPK_BLOCS},
+    {81920, KRK_MIXTES, KRK_UNIFORMES, KRK_RANGS, KRK_BLOCS},
+    {81920, KQK_MIXTES, KQK_UNIFORMES, KQK_RANGS, KQK_BLOCS},
+};
+
+#endif
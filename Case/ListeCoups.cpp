@@ -0,0 +1,162 @@
+#include <ListeCoups.h>
+#include <string.h>
+
+// Constructeur. Creer une liste vide
+ListeCoups::ListeCoups()
+{
+  vider();
+}
+
+// Retire tous les coups de la liste
+void ListeCoups::vider()
+{
+  memset(_debut, 0, sizeof(_debut));
+  memset(_nombre, 0, sizeof(_nombre));
+  _total = 0;
+}
+
+// Genere les coups legaux d'un joueur et les range par case de depart
+// Board::genererCoups donne deja les coups d'une piece les uns a la suite des autres :
+// il suffit de noter ou commence chaque case de depart. Retourne le nombre total de coups
+int ListeCoups::generer(const Board &plateau, short joueur)
+{
+  vider();
+  _total = plateau.genererCoups(joueur, _coups);
+
+  for (int i = 0; i < _total; i++)
+  {
+    short depart = departCoup(_coups[i]);
+
+    if (_nombre[depart] == 0)
+    {
+      _debut[depart] = i;
+    }
+    _nombre[depart]++;
+  }
+  return _total;
+}
+
+// Ne garde que 'coup' dans la liste : le joueur ne peut plus jouer que ce coup (coup propose par le Moteur)
+// Retourne faux, sans rien changer, si 'coup' n'est pas dans la liste
+bool ListeCoups::garder(Coup coup)
+{
+  short depart = departCoup(coup);
+
+  if (trouver(depart, arriveeCoup(coup)) != coup)
+  {
+    return false;
+  }
+  vider();
+  _coups[0] = coup;
+  _debut[depart] = 0;
+  _nombre[depart] = 1;
+  _total = 1;
+  return true;
+}
+
+// Retourne le nombre total de coups legaux. 0 indique un echec et mat ou un pat
+int ListeCoups::nombre() const
+{
+  return _total;
+}
+
+// Retourne le nombre de coups legaux de la piece sur une case
+int ListeCoups::nombre(short depart) const
+{
+  return _nombre[depart];
+}
+
+// Retourne un pointeur vers le premier coup de la piece sur une case. Voir nombre(depart)
+const Coup *ListeCoups::depuis(short depart) const
+{
+  return _coups + _debut[depart];
+}
+
+// Retourne les cases d'arrivee de la piece sur une case sous forme de bitboard
+uint64_t ListeCoups::arrivees(short depart) const
+{
+  uint64_t masque = 0;
+
+  for (int i = 0; i < _nombre[depart]; i++)
+  {
+    masque |= bitCase(arriveeCoup(depuis(depart)[i]));
+  }
+  return masque;
+}
+
+// Retourne le coup entre deux cases, ou COUP_NUL si aucun coup ne correspond
+// Une promotion donne une reine, qui est generee en premier
+Coup ListeCoups::trouver(short depart, short arrivee) const
+{
+  for (int i = 0; i < _nombre[depart]; i++)
+  {
+    if (arriveeCoup(depuis(depart)[i]) == arrivee)
+    {
+      return depuis(depart)[i];
+    }
+  }
+  return COUP_NUL;
+}
+
+// Retourne le coup legal qui change les senseurs comme 'difference' entre le debut et la fin du tour
+// 'touches' : toutes les cases qui ont change pendant le tour. Une capture ne change pas l'occupation de sa case
+// d'arrivee, la piece capturee doit donc y avoir ete levee. Seules les pieces levees sont essayees.
+// Retourne COUP_NUL si aucun coup ne correspond, ou si plusieurs coups entre des cases differentes correspondent
+Coup ListeCoups::decoder(const Difference &difference, uint64_t touches) const
+{
+  Coup trouve = COUP_NUL;
+  uint64_t departs = difference.leves;
+
+  while (departs)
+  {
+    short depart = extraireCase(departs);
+
+    for (int i = 0; i < _nombre[depart]; i++)
+    {
+      Coup coup = depuis(depart)[i];
+      short arrivee = arriveeCoup(coup);
+      uint64_t leves = bitCase(depart); // Cases videes par le coup
+      uint64_t poses = 0;               // Cases remplies par le coup
+      uint64_t prise = 0;               // Case d'une capture, occupee avant et apres le coup
+
+      if (drapeauxCoup(coup) == COUP_EN_PASSANT)
+      {
+        leves |= bitCase(numeroCase(depart / TAILLE, arrivee % TAILLE));
+        poses |= bitCase(arrivee);
+      }
+      else if (estCapture(coup))
+      {
+        prise = bitCase(arrivee);
+      }
+      else
+      {
+        poses |= bitCase(arrivee);
+      }
+
+      if (estRoque(coup))
+      {
+        short tourDepart, tourArrivee;
+
+        Board::tourRoque(coup, tourDepart, tourArrivee);
+        leves |= bitCase(tourDepart);
+        poses |= bitCase(tourArrivee);
+      }
+
+      if (leves != difference.leves || poses != difference.poses || (prise & ~touches))
+      {
+        continue;
+      }
+
+      // Les promotions d'un meme pion partagent leurs cases : la premiere, une reine, est gardee
+      if (trouve == COUP_NUL)
+      {
+        trouve = coup;
+      }
+      else if (departCoup(trouve) != depart || arriveeCoup(trouve) != arrivee)
+      {
+        return COUP_NUL;
+      }
+    }
+  }
+  return trouve;
+}
@@ -0,0 +1,41 @@
+/*
+ListeCoups.h - Coups legaux du joueur actif, generes une seule fois au debut du tour
+Les coups sont ranges par case de depart : soulever une piece ne demande qu'une lecture dans la table,
+sans regenerer les coups. Redeposer la piece et la soulever a nouveau ne refait aucun calcul.
+decoder() retrouve un coup complet (capture, prise en passant, roque) a partir des cases changees pendant le tour.
+*/
+
+#ifndef ListeCoups_h
+
+#define ListeCoups_h
+
+#include <stdint.h>
+#include <Board.h>
+#include <Difference.h>
+
+// Objet. Coups legaux d'une position, indexes par case de depart
+class ListeCoups
+{
+public:
+  ListeCoups();
+
+  int generer(const Board &plateau, short joueur);
+  void vider();
+  bool garder(Coup coup);
+
+  int nombre() const;
+  int nombre(short depart) const;
+  const Coup *depuis(short depart) const;
+  uint64_t arrivees(short depart) const;
+  Coup trouver(short depart, short arrivee) const;
+  Coup decoder(const Difference &difference, uint64_t touches) const;
+
+private:
+  // Un _ devant une variable indique que celle-ci est propre a une instance de type ListeCoups
+
+  Coup _coups[MAX_COUPS]; // Coups legaux. Les coups d'une meme case de depart se suivent
+  uint8_t _debut[64];     // Index du premier coup de chaque case de depart dans _coups
+  uint8_t _nombre[64];    // Nombre de coups de chaque case de depart
+  int _total;             // Nombre total de coups legaux
+};
+#endif
@@ -0,0 +1,105 @@
+#include <Livre.h>
+#include <LivreDonnees.h>
+
+// Retourne la cle complete d'une entree
+static inline uint64_t cleEntree(const EntreeLivre &entree)
+{
+  return ((uint64_t)entree.cleHaute << 32) | entree.cleBasse;
+}
+
+// Retourne le nombre d'entrees du livre
+int entreesLivre()
+{
+  return ENTREES_LIVRE;
+}
+
+// Retourne une entree du livre, dans l'ordre des cles
+const EntreeLivre &entreeLivre(int index)
+{
+  return LIVRE[index];
+}
+
+// Retourne l'index de la premiere entree de la position 'cle', ou -1 si la position n'est pas dans le livre
+// Recherche binaire de la premiere cle qui n'est pas plus petite que 'cle'
+int chercherLivre(uint64_t cle)
+{
+  int debut = 0;
+  int fin = ENTREES_LIVRE;
+
+  while (debut < fin)
+  {
+    int milieu = (debut + fin) / 2;
+
+    if (cleEntree(LIVRE[milieu]) < cle)
+    {
+      debut = milieu + 1;
+    }
+    else
+    {
+      fin = milieu;
+    }
+  }
+  return (debut < ENTREES_LIVRE && cleEntree(LIVRE[debut]) == cle) ? debut : -1;
+}
+
+// Remplit 'coups' et 'poids' avec les coups du livre pour la position, le plus joue en premier
+// Seuls les coups legaux sont gardes. Retourne le nombre de coups, au plus COUPS_LIVRE_MAX. 0 hors du livre
+int coupsLivre(const Board &plateau, Coup *coups, uint16_t *poids)
+{
+  uint64_t cle = plateau.cle();
+  int index = chercherLivre(cle);
+  int nombre = 0;
+  Coup legaux[MAX_COUPS];
+  int nombreLegaux;
+
+  if (index < 0)
+  {
+    return 0;
+  }
+
+  nombreLegaux = plateau.genererCoups(plateau.getTrait(), legaux);
+  for (; index < ENTREES_LIVRE && cleEntree(LIVRE[index]) == cle && nombre < COUPS_LIVRE_MAX; index++)
+  {
+    for (int i = 0; i < nombreLegaux; i++)
+    {
+      if (legaux[i] == LIVRE[index].coup)
+      {
+        coups[nombre] = LIVRE[index].coup;
+        poids[nombre] = LIVRE[index].poids;
+        nombre++;
+        break;
+      }
+    }
+  }
+  return nombre;
+}
+
+// Retourne un coup du livre pour la position, tire au hasard selon les poids, ou COUP_NUL hors du livre
+// 'hasard' : un nombre quelconque, par exemple le temps en microsecondes
+Coup choisirLivre(const Board &plateau, uint32_t hasard)
+{
+  Coup coups[COUPS_LIVRE_MAX];
+  uint16_t poids[COUPS_LIVRE_MAX];
+  int nombre = coupsLivre(plateau, coups, poids);
+  uint32_t total = 0;
+
+  for (int i = 0; i < nombre; i++)
+  {
+    total += poids[i];
+  }
+  if (total == 0)
+  {
+    return COUP_NUL;
+  }
+
+  hasard %= total;
+  for (int i = 0; i < nombre; i++)
+  {
+    if (hasard < poids[i])
+    {
+      return coups[i];
+    }
+    hasard -= poids[i];
+  }
+  return coups[0];
+}
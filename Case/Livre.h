@@ -0,0 +1,39 @@
+/*
+Livre.h - Livre d'ouvertures : coups connus des premiers coups d'une partie, retrouves par la cle Zobrist
+Le livre est un tableau d'entrees (cle, coup, poids) trie par cle, genere sur un ordinateur par Livre/livre.cpp
+a partir d'une collection de parties PGN (voir LivreDonnees.h). Une position est cherchee par recherche binaire
+directement dans le tableau, sans copie en memoire vive : une vingtaine de comparaisons pour quelques milliers d'entrees.
+Sur l'ESP32, un tableau const reste dans la flash et y est lu a travers le cache : PROGMEM n'y change rien,
+mais garde le livre hors de la memoire vive sur une carte AVR.
+Le coup d'une entree est verifie parmi les coups legaux : une collision de cle ne donne jamais un coup illegal.
+*/
+
+#ifndef Livre_h
+
+#define Livre_h
+
+#include <stdint.h>
+#include <Board.h>
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+#define COUPS_LIVRE_MAX 16 // Coups differents au plus pour une meme position du livre
+
+// Structure. Une entree du livre. La cle est coupee en deux mots pour tenir en 12 octets
+struct EntreeLivre
+{
+  uint32_t cleHaute; // 32 bits du haut de la cle Zobrist de la position
+  uint32_t cleBasse; // 32 bits du bas
+  Coup coup;         // Coup joue dans cette position
+  uint16_t poids;    // Nombre de parties de la collection qui ont joue ce coup
+};
+
+int entreesLivre();
+const EntreeLivre &entreeLivre(int index);
+int chercherLivre(uint64_t cle);
+int coupsLivre(const Board &plateau, Coup *coups, uint16_t *poids);
+Coup choisirLivre(const Board &plateau, uint32_t hasard);
+
+#endif
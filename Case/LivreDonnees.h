@@ -0,0 +1,383 @@
+/*
+LivreDonnees.h - Livre d'ouvertures genere par Livre/livre.cpp. Ne pas modifier a la main
+Source : Livre/ouvertures.pgn, 12 premiers demi-coups de chaque partie
+Inclus seulement par Livre.cpp. Entrees triees par cle (voir Livre.h)
+*/
+
+#ifndef LivreDonnees_h
+
+#define LivreDonnees_h
+
+#include <Livre.h>
+
+#define ENTREES_LIVRE 365
+
+static const EntreeLivre LIVRE[ENTREES_LIVRE] PROGMEM = {
+    {0x011DEB22, 0x0B0AFD49, 0x0C7A, 1},
+    {0x013F34FF, 0x1D909621, 0x170C, 1},
+    {0x01665848, 0x8A869CEB, 0x08DB, 1},
+    {0x01665848, 0x8A869CEB, 0x0546, 1},
+    {0x018047FC, 0xC0E46761, 0x0982, 3},
+    {0x018047FC, 0xC0E46761, 0x0742, 2},
+    {0x018047FC, 0xC0E46761, 0x170C, 1},
+    {0x0269BF0E, 0xD0471BD0, 0x0BA4, 1},
+    {0x027F79AC, 0xA9185C07, 0x0C7A, 1},
+    {0x02AD89C2, 0x8EF088D3, 0x0546, 1},
+    {0x02D9F151, 0x53377590, 0x0B34, 1},
+    {0x031E170B, 0xE45AC305, 0x174D, 7},
+    {0x03ECA357, 0x8CBB635B, 0x0242, 1},
+    {0x04191115, 0x99C62E89, 0x0AF3, 1},
+    {0x04509B60, 0x12681B14, 0x168A, 1},
+    {0x049AE3E6, 0x2ED63465, 0x0AB9, 1},
+    {0x052DB90A, 0x1B2FF3AD, 0x0AB9, 1},
+    {0x062F6918, 0xF8DD8F8B, 0x0AB9, 1},
+    {0x08F86ED8, 0x7AD3BF9D, 0x4B74, 1},
+    {0x0A1EF21A, 0x60379F02, 0x454E, 1},
+    {0x0AC73A6A, 0x680C1043, 0x04A3, 1},
+    {0x0BE5403B, 0x4D3F1E1C, 0x0AB2, 1},
+    {0x0D09CCD1, 0xA6686BB7, 0x4B74, 1},
+    {0x0D3DFB4C, 0x01927447, 0x0A71, 1},
+    {0x0E367B7D, 0x7D01308C, 0x4564, 1},
+    {0x0F33AB55, 0xA936859A, 0x05CF, 1},
+    {0x10C58BDA, 0x692DBB75, 0x04CB, 1},
+    {0x1178697A, 0x724149AD, 0x0306, 1},
+    {0x141B93AE, 0xED0C4498, 0x08BD, 1},
+    {0x15C1A0FE, 0x774F6FFD, 0x2043, 1},
+    {0x174E4E68, 0x99A69B3B, 0x0481, 1},
+    {0x17645E2E, 0x3F2A5FF4, 0x2043, 1},
+    {0x17EF431E, 0x4B7E9471, 0x08BD, 1},
+    {0x18C52019, 0xD7A0B13F, 0x0BF7, 1},
+    {0x19341C60, 0xF1EE32FC, 0x16CB, 24},
+    {0x19341C60, 0xF1EE32FC, 0x170C, 13},
+    {0x19341C60, 0xF1EE32FC, 0x174D, 2},
+    {0x19341C60, 0xF1EE32FC, 0x0481, 1},
+    {0x1B6C512A, 0xBA737156, 0x00C2, 1},
+    {0x1C252F7F, 0x6DC2B928, 0x08BD, 1},
+    {0x1DB67E8D, 0x453937F9, 0x07BA, 1},
+    {0x1E2D9D26, 0x22B8D345, 0x092A, 1},
+    {0x1E875752, 0x40E2B464, 0x092A, 1},
+    {0x1EA2F136, 0x40B9E0C5, 0x0481, 1},
+    {0x1F1F3C25, 0x31EDA126, 0x0CFA, 1},
+    {0x1FF3D4AA, 0x7931C136, 0x04C5, 1},
+    {0x2057A486, 0x3691C6CE, 0x1934, 1},
+    {0x20596F47, 0x3E848CE2, 0x096D, 1},
+    {0x2066DE43, 0xE7A00C0A, 0x4B5C, 1},
+    {0x21C9CFFC, 0x8BAAF12C, 0x174D, 1},
+    {0x21D9C989, 0x70CD7A30, 0x0502, 1},
+    {0x234A75C0, 0xFB9B56CE, 0x091C, 1},
+    {0x238CB63D, 0x9CB0E3D9, 0x04C5, 1},
+    {0x24BA428E, 0x322193D0, 0x0D3E, 1},
+    {0x2629D18F, 0x6A094B6A, 0x0481, 1},
+    {0x265E86E9, 0xF900D6E7, 0x0546, 1},
+    {0x2684D5CD, 0x9D4D3156, 0x0661, 1},
+    {0x276A3FCD, 0x18876FCF, 0x4B76, 1},
+    {0x28015766, 0xF03E10E1, 0x0481, 1},
+    {0x28BF69E7, 0xB29B1E1B, 0x0502, 1},
+    {0x290A77C9, 0xD022D55B, 0x1975, 1},
+    {0x2A9720D8, 0x9C4FA48A, 0x2043, 1},
+    {0x2B35FF8F, 0xA53D9B2C, 0x4712, 1},
+    {0x2B957BA2, 0x0B85B8D2, 0x0AB9, 1},
+    {0x2BDB1094, 0xC68963E3, 0x0242, 1},
+    {0x2D0DA725, 0xBB9D41C1, 0x4712, 1},
+    {0x2D2FD73D, 0x0751D9D9, 0x0742, 1},
+    {0x2D87B693, 0xBF8EE669, 0x0481, 1},
+    {0x2DE426AC, 0xFDB46EED, 0x2E7B, 1},
+    {0x2F37730F, 0xD8B5C910, 0x04CB, 1},
+    {0x2FDBFCE2, 0x06509EC7, 0x0546, 1},
+    {0x325A3941, 0xAE362725, 0x46EA, 1},
+    {0x33A8960C, 0x402378CF, 0x4B66, 1},
+    {0x35F1F789, 0x13E46F3E, 0x170C, 1},
+    {0x36093BC9, 0xAD2F19ED, 0x0982, 1},
+    {0x36093BC9, 0xAD2F19ED, 0x170C, 1},
+    {0x36593405, 0x9C98ACE5, 0x07E6, 1},
+    {0x36593405, 0x9C98ACE5, 0x4B66, 1},
+    {0x374275D4, 0x0EDE1FC9, 0x1975, 1},
+    {0x37E8BFA0, 0x6C8478E8, 0x0B7E, 1},
+    {0x38ECAE9F, 0x884FF4AB, 0x170C, 1},
+    {0x3936EF88, 0xE2080EE1, 0x04C5, 1},
+    {0x39607EAB, 0xEE2FA737, 0x0546, 1},
+    {0x39EA6FE3, 0x3AA3D5F7, 0x0AF3, 1},
+    {0x3A5D2C93, 0xE88FFA41, 0x08DB, 1},
+    {0x3AB48779, 0x6C590ACB, 0x0BF7, 2},
+    {0x3AB48779, 0x6C590ACB, 0x0AB9, 1},
+    {0x3AF7E6E7, 0x8AD59D60, 0x08DB, 1},
+    {0x3BE91B67, 0xE611017F, 0x0C7A, 1},
+    {0x3BE91B67, 0xE611017F, 0x1934, 1},
+    {0x3D2D4D63, 0x7CBB1346, 0x170C, 1},
+    {0x3D878717, 0x1EE17467, 0x170C, 1},
+    {0x3D940F91, 0x23E0CAB5, 0x2043, 1},
+    {0x3E24D5BA, 0xCC887BE2, 0x0B7E, 1},
+    {0x3E4BBA17, 0x6CA43176, 0x0AF3, 1},
+    {0x3E4BBA17, 0x6CA43176, 0x4764, 1},
+    {0x3F5EA612, 0x375517ED, 0x1934, 3},
+    {0x4029E297, 0x34A6A785, 0x0B34, 1},
+    {0x40A89130, 0xC790AD1C, 0x0AB9, 7},
+    {0x40A89130, 0xC790AD1C, 0x1934, 5},
+    {0x40A89130, 0xC790AD1C, 0x18B2, 1},
+    {0x40EF06FE, 0x405BA097, 0x0BF7, 1},
+    {0x415579DE, 0xAA1DE88E, 0x1934, 1},
+    {0x41C8D149, 0x938E9DD7, 0x0B7E, 1},
+    {0x4271118B, 0x5EF67C56, 0x0B34, 1},
+    {0x434FA138, 0x2E07E56D, 0x04C5, 1},
+    {0x45A942A4, 0x642837C4, 0x0B7E, 1},
+    {0x4653D7CF, 0x1660005D, 0x08DB, 1},
+    {0x48A5B165, 0x8074F284, 0x2043, 1},
+    {0x48E6D0FB, 0x66F8652F, 0x0AB9, 1},
+    {0x49324700, 0x89ABD2E7, 0x1934, 1},
+    {0x4A925FAD, 0x68C7DA69, 0x0449, 1},
+    {0x4B81C44D, 0xFE1F6C4F, 0x067D, 1},
+    {0x4B90E0A2, 0x3D11871A, 0x0B75, 2},
+    {0x4B90E0A2, 0x3D11871A, 0x0AF3, 1},
+    {0x4B90E0A2, 0x3D11871A, 0x4764, 1},
+    {0x4D2676AB, 0x45F83FB3, 0x0305, 1},
+    {0x4E0725B8, 0xB1AF9AC7, 0x0BBC, 1},
+    {0x4E2A5D3A, 0x78735E49, 0x1608, 1},
+    {0x4E64B587, 0xF3951243, 0x0481, 1},
+    {0x4E70ED35, 0xA983ECFD, 0x0CFA, 1},
+    {0x4FA21244, 0xDEC64343, 0x0A71, 1},
+    {0x4FA21244, 0xDEC64343, 0x0BF7, 1},
+    {0x5052E55B, 0x2BD28350, 0x0B75, 1},
+    {0x5251AE3B, 0x6A96820F, 0x0D2A, 1},
+    {0x5277E85F, 0x0B8DF445, 0x0AB9, 1},
+    {0x53AC53D0, 0x4B111668, 0x2043, 1},
+    {0x544FB0F5, 0x152D2EA8, 0x0AB9, 1},
+    {0x5452EF93, 0xBF439816, 0x492B, 1},
+    {0x563EB445, 0x1F9A65BB, 0x04CB, 1},
+    {0x56C6BD0C, 0x3FBA12E2, 0x0242, 1},
+    {0x57115220, 0x2D324865, 0x0449, 1},
+    {0x575B9627, 0xCC1063CF, 0x054D, 1},
+    {0x581CCAAC, 0xF69AF881, 0x4723, 1},
+    {0x58A3B9AF, 0x2BEE09C1, 0x0B1B, 1},
+    {0x59844DBE, 0xE7A8409D, 0x04CB, 1},
+    {0x5A077E15, 0x8034BF74, 0x0A62, 1},
+    {0x5BEC9265, 0xAC73B953, 0x0A71, 1},
+    {0x5D4FED58, 0xFA472E41, 0x0A71, 1},
+    {0x5E054C24, 0x33940C26, 0x0481, 7},
+    {0x5E054C24, 0x33940C26, 0x0546, 1},
+    {0x5E054C24, 0x33940C26, 0x168A, 1},
+    {0x5F3EE121, 0xEB7C2196, 0x0AB9, 1},
+    {0x5FA9FB5D, 0xF7B8B71E, 0x0502, 1},
+    {0x5FCAED19, 0x1DABD2D7, 0x2E7B, 1},
+    {0x60A9BC62, 0x7E60C973, 0x1975, 1},
+    {0x617023CF, 0xBE316B4B, 0x4723, 1},
+    {0x6289AC0E, 0xBE0D4E78, 0x0CFC, 1},
+    {0x62A27A51, 0xF1F42325, 0x0304, 1},
+    {0x63F3D766, 0xDF56C6DE, 0x07BA, 2},
+    {0x641B0A47, 0x289FEB87, 0x0B34, 1},
+    {0x64B1C033, 0x4AC58CA6, 0x4725, 1},
+    {0x66AD2A21, 0x150E8F03, 0x0481, 1},
+    {0x66C22B42, 0x012B880D, 0x170C, 3},
+    {0x678C7D0F, 0x7D43B60E, 0x2E7B, 1},
+    {0x678F772A, 0xC54AB5A2, 0x4B66, 1},
+    {0x67A3E20A, 0x2D4616F0, 0x08D2, 1},
+    {0x67E7B91D, 0x84DB0301, 0x2043, 1},
+    {0x6BA449CE, 0x01DFCC0B, 0x054D, 1},
+    {0x6BCA504D, 0xF2C59CC0, 0x4764, 1},
+    {0x6BDD508A, 0x3DFD0296, 0x050C, 1},
+    {0x6BEC184E, 0x8A647B23, 0x18F3, 1},
+    {0x6C6D7AD9, 0x259AF0DE, 0x0AB9, 1},
+    {0x6C8A86AF, 0xE7002004, 0x0449, 1},
+    {0x6E8137FB, 0x4560B786, 0x0B75, 1},
+    {0x6F95B699, 0x9B51860D, 0x4725, 1},
+    {0x706ADE8D, 0xFBA718FA, 0x0A30, 1},
+    {0x71C62181, 0xF27CBB8A, 0x18F3, 1},
+    {0x71CB3661, 0x24A96EAB, 0x0742, 1},
+    {0x71FD954B, 0x60969B14, 0x0AB9, 1},
+    {0x743E5F04, 0x14F077C4, 0x050C, 1},
+    {0x74C52839, 0xF2D3BCA5, 0x17CF, 1},
+    {0x74CEDD43, 0x9787E795, 0x1871, 1},
+    {0x7641AD7C, 0xFE45E35B, 0x0AB9, 1},
+    {0x768BD5FA, 0xC2FBCC2A, 0x08DB, 1},
+    {0x76F73CB8, 0x51195629, 0x0CDE, 1},
+    {0x773C8F16, 0xF7020BE2, 0x04CB, 1},
+    {0x777AD76C, 0x7F4A7D73, 0x0B34, 1},
+    {0x7806371C, 0x6517B78B, 0x18F3, 1},
+    {0x7A51D219, 0xA39F731A, 0x0546, 1},
+    {0x7AB48F4B, 0xFFCF4E52, 0x1934, 1},
+    {0x7AC18138, 0x10A4A4AB, 0x0546, 1},
+    {0x7B57345A, 0x7580D42C, 0x1934, 1},
+    {0x7BA90680, 0x3D5C39E5, 0x2043, 1},
+    {0x7C9FAF0E, 0x3FCCDD88, 0x0481, 1},
+    {0x7CDA8095, 0x1AD7B117, 0x455E, 1},
+    {0x7D22621D, 0x4E989C6B, 0x0AF3, 1},
+    {0x8068BF94, 0x2927ACDF, 0x0AB9, 1},
+    {0x819D6B2C, 0x4F6972D8, 0x2E7B, 1},
+    {0x82B404EF, 0x785EADA8, 0x454E, 1},
+    {0x82BBF84A, 0x339B7085, 0x0B7E, 1},
+    {0x83054698, 0xE8745994, 0x0B34, 1},
+    {0x839D7128, 0xE135DE31, 0x170C, 2},
+    {0x84348998, 0xE67F3C3E, 0x0449, 1},
+    {0x84685345, 0xB8706497, 0x05CF, 1},
+    {0x851D38F3, 0x444657A2, 0x054D, 1},
+    {0x8527DF62, 0x5142811D, 0x04C5, 1},
+    {0x85D73289, 0x6C30A640, 0x491D, 1},
+    {0x8633DB6C, 0x69CDDBC9, 0x2E7B, 1},
+    {0x87B517B9, 0x4BE9E545, 0x058E, 1},
+    {0x883A31DF, 0xD49FCA6E, 0x0546, 1},
+    {0x890C4E29, 0xCEA10140, 0x46EA, 1},
+    {0x893220B3, 0xC584A6E2, 0x4725, 1},
+    {0x89E176AE, 0xC8D2373B, 0x0449, 1},
+    {0x8A843E80, 0x061F77D5, 0x170C, 1},
+    {0x8D80E543, 0x3F749D28, 0x4715, 1},
+    {0x8DE4E86B, 0x37AFDCF8, 0x0A30, 1},
+    {0x8E2E4CD6, 0xB1606CF9, 0x46A3, 1},
+    {0x8EC0872C, 0xC7DD09F2, 0x00C2, 1},
+    {0x8ED4DF9E, 0x9DCBF74C, 0x0CFA, 1},
+    {0x8F8F27C4, 0x11C74926, 0x174D, 4},
+    {0x8F8F27C4, 0x11C74926, 0x0685, 1},
+    {0x90322028, 0xBDF9D5D0, 0x455E, 1},
+    {0x90325247, 0xEB559B41, 0x0AB9, 2},
+    {0x9045D6E0, 0x6B67D1DD, 0x02C2, 1},
+    {0x90AE35EB, 0x13AB862C, 0x0481, 1},
+    {0x90BAC28D, 0xC5C27F88, 0x0D3E, 1},
+    {0x93CACC08, 0xB51A113B, 0x0546, 2},
+    {0x93FF612C, 0xAB42E75F, 0x0B34, 1},
+    {0x947B88A0, 0xD7BCB0E6, 0x04C5, 1},
+    {0x950AD3BF, 0x725D0058, 0x045B, 1},
+    {0x968EDE5C, 0x71C480B4, 0x0CFA, 1},
+    {0x969E4465, 0xF0C61CE7, 0x0CFA, 1},
+    {0x96FE030F, 0xD42FD0B1, 0x0481, 1},
+    {0x97DD63EC, 0x6AAFE731, 0x170C, 2},
+    {0x9854DFE1, 0x02130E19, 0x099D, 1},
+    {0x9899EDC4, 0xF787861D, 0x4712, 2},
+    {0x993288BB, 0x79DAEEE4, 0x0B3A, 1},
+    {0x99B69DB3, 0x4BC383D4, 0x08DB, 1},
+    {0x9B553AEE, 0x9ABA9D30, 0x2043, 1},
+    {0x9C8FE64C, 0x3B62ACF6, 0x46D5, 1},
+    {0x9D766527, 0x9381E174, 0x0546, 1},
+    {0x9E3CC45B, 0x5A52C313, 0x0A71, 1},
+    {0x9E555536, 0x6925640D, 0x092C, 1},
+    {0xA016DEF7, 0x3E3437F4, 0x0502, 1},
+    {0xA0418809, 0x45A85734, 0x0BB6, 1},
+    {0xA24E8B4A, 0xBB185E40, 0x0AB9, 1},
+    {0xA4A32148, 0xBC5C8AE8, 0x0B7E, 1},
+    {0xA5EDFF45, 0x7E539897, 0x0306, 1},
+    {0xA6390C55, 0xC8432162, 0x09E4, 1},
+    {0xA6A95F74, 0x7B78F6D3, 0x0D7C, 1},
+    {0xA6B40012, 0xD116406D, 0x0AF3, 1},
+    {0xA757D304, 0xEA85E60E, 0x0CFA, 1},
+    {0xA846BBDF, 0x260A608E, 0x1934, 1},
+    {0xA86050B2, 0xE19CD0CD, 0x2E7B, 1},
+    {0xA8F3B0EA, 0x59B7CFF5, 0x4B74, 1},
+    {0xAB1C9F1D, 0xA0A29318, 0x0765, 1},
+    {0xAB4FA9A2, 0xBB5730C3, 0x492A, 1},
+    {0xAB624286, 0x2E40BD7B, 0x16CB, 1},
+    {0xAB6D3A93, 0x53A3E799, 0x0CFA, 1},
+    {0xACD46192, 0x090122E4, 0x0845, 1},
+    {0xAF321E84, 0x9CACE200, 0x18F3, 1},
+    {0xAF483A58, 0x745A0DED, 0x0AF3, 1},
+    {0xB1104E98, 0x2B6D52B9, 0x048A, 1},
+    {0xB2E826DF, 0x4BF80E47, 0x0B7E, 1},
+    {0xB532847F, 0x5E500E09, 0x0AB9, 1},
+    {0xB5745CDB, 0x7CFD1A87, 0x0852, 1},
+    {0xB68D62AA, 0x4027520D, 0x4764, 1},
+    {0xB6CC1C5C, 0x1D127062, 0x491B, 1},
+    {0xB72E1B5A, 0x749DEB02, 0x0AF3, 1},
+    {0xB7B241D3, 0x901BA08B, 0x0481, 1},
+    {0xB7EC2486, 0x21B6A671, 0x2043, 1},
+    {0xBBB8D607, 0x779535C2, 0x48D2, 1},
+    {0xBC4DD517, 0x328B6587, 0x2E7B, 1},
+    {0xBC60259B, 0xA2AFBF0B, 0x18F3, 9},
+    {0xBC60259B, 0xA2AFBF0B, 0x1975, 7},
+    {0xBC60259B, 0xA2AFBF0B, 0x0AF3, 3},
+    {0xBC60259B, 0xA2AFBF0B, 0x0B75, 2},
+    {0xBC60259B, 0xA2AFBF0B, 0x0B34, 1},
+    {0xBC60259B, 0xA2AFBF0B, 0x1934, 1},
+    {0xBC60259B, 0xA2AFBF0B, 0x0AB9, 1},
+    {0xBD6CE672, 0xE3AECDF1, 0x1975, 1},
+    {0xBE6E4946, 0x1A52D3FB, 0x0C7A, 1},
+    {0xBF46EC70, 0xA52B225F, 0x05CF, 1},
+    {0xBF9B092A, 0xB48A94A6, 0x0546, 2},
+    {0xBF9B092A, 0xB48A94A6, 0x0449, 1},
+    {0xBF9B092A, 0xB48A94A6, 0x0481, 1},
+    {0xBFD57F0D, 0xB3AD9AE2, 0x491B, 1},
+    {0xC26EC221, 0xAB1F101B, 0x0C7A, 1},
+    {0xC4D7402F, 0xE4A49AA0, 0x0481, 1},
+    {0xC5691DB4, 0xFFA17313, 0x491D, 1},
+    {0xC723B263, 0xB27DF646, 0x0481, 1},
+    {0xC7656AC7, 0x90D0E2C8, 0x097A, 1},
+    {0xC7656AC7, 0x90D0E2C8, 0x0AB9, 1},
+    {0xC7A0623D, 0x51D58188, 0x0C7A, 1},
+    {0xC7C9D866, 0x5F5BFBED, 0x170C, 1},
+    {0xC9269595, 0x4B028B9E, 0x07BA, 1},
+    {0xC9A9E01B, 0x9BB8CD8D, 0x0B7E, 6},
+    {0xC9A9E01B, 0x9BB8CD8D, 0x0AB9, 1},
+    {0xCB1B2E09, 0xEEFDD82C, 0x0BFD, 1},
+    {0xCBAA310F, 0xE548612E, 0x4712, 1},
+    {0xCBE0C399, 0xEFBDAC63, 0x0481, 1},
+    {0xCE41EEBC, 0x5CD178D1, 0x1934, 2},
+    {0xD05FBD56, 0x5735A60F, 0x0242, 1},
+    {0xD0AEADE3, 0xF3FA3902, 0x170C, 1},
+    {0xD318B3D0, 0x3061E835, 0x0AB9, 1},
+    {0xD318EA93, 0x2253ACF0, 0x1608, 1},
+    {0xD369B6E6, 0x6677250B, 0x054D, 1},
+    {0xD43C2A5D, 0x72721849, 0x0AF3, 1},
+    {0xD471B8BD, 0x689BA946, 0x0B34, 1},
+    {0xD4C1F31E, 0x6E7B269A, 0x19B6, 1},
+    {0xD641FD12, 0xB375A146, 0x2E7B, 1},
+    {0xD951CE9D, 0x291DE341, 0x0B7E, 1},
+    {0xD9CDF78C, 0x5E64451C, 0x4742, 1},
+    {0xD9FB04E9, 0x4B478460, 0x1975, 1},
+    {0xDA01FC78, 0xD74B41D1, 0x4725, 2},
+    {0xDBEEDDA0, 0xE852BB6C, 0x2E7B, 1},
+    {0xDBF0A1E9, 0xDF87261C, 0x02C2, 1},
+    {0xDC1B9A01, 0xBAABE808, 0x0BB6, 1},
+    {0xDC8442A9, 0x63658C12, 0x491D, 1},
+    {0xDCC69CFC, 0x7C7D2C04, 0x0449, 1},
+    {0xDDD1D835, 0xE0AC0D97, 0x050C, 1},
+    {0xDEC5578E, 0xE52CDAAB, 0x0AB9, 1},
+    {0xDFAF563C, 0x5FB34429, 0x170C, 1},
+    {0xE1814FC3, 0x5BFC3A06, 0x09ED, 1},
+    {0xE1DBFA14, 0x5937E974, 0x0AB9, 2},
+    {0xE223645B, 0x0778630E, 0x0546, 2},
+    {0xE2CB3189, 0x17A85A19, 0x0C7A, 1},
+    {0xE46AF787, 0x8FD2C32E, 0x19B6, 1},
+    {0xE504DB00, 0x86882BA4, 0x1975, 1},
+    {0xE59562DF, 0x51DD4A73, 0x1975, 1},
+    {0xE5AE1174, 0xE4D24C85, 0x0B7E, 1},
+    {0xE5FA80D3, 0xCE9AE6C9, 0x0CF9, 1},
+    {0xE6F652A7, 0xC719FBC5, 0x454D, 1},
+    {0xE7252870, 0x0DB7F1A1, 0x16CB, 1},
+    {0xE781C52B, 0x8DCD5307, 0x0546, 2},
+    {0xE7F33458, 0xD1AC72F3, 0x0344, 1},
+    {0xE7F33458, 0xD1AC72F3, 0x04CB, 1},
+    {0xE8982C92, 0xF543D086, 0x493C, 1},
+    {0xE8A83997, 0x669C8EB1, 0x0242, 1},
+    {0xE9C665A6, 0xC0FADDD6, 0x0B34, 1},
+    {0xEA5971E2, 0xE12D10A3, 0x0AF3, 1},
+    {0xEBCAFA06, 0x57655C70, 0x1934, 1},
+    {0xEBDC6DBB, 0xBDD16828, 0x0242, 1},
+    {0xEBF1869F, 0x28C6E590, 0x492A, 1},
+    {0xEC7F0E0E, 0xA5EA8AB7, 0x099C, 1},
+    {0xEC8C6B21, 0x12DF6A96, 0x18F3, 1},
+    {0xEC8C6B21, 0x12DF6A96, 0x1975, 1},
+    {0xECA93623, 0x2EBD58C5, 0x46E4, 1},
+    {0xEE647B40, 0x398EA056, 0x0481, 1},
+    {0xEFA5376D, 0x2798AE05, 0x0CF9, 1},
+    {0xEFE6D7CB, 0xF00593FB, 0x48DA, 1},
+    {0xF07910E6, 0xE102F3D7, 0x08DB, 1},
+    {0xF07910E6, 0xE102F3D7, 0x0546, 1},
+    {0xF07910E6, 0xE102F3D7, 0x0306, 1},
+    {0xF2798988, 0xC50A5490, 0x2043, 1},
+    {0xF32EA6C0, 0x1D8AFA82, 0x08BD, 1},
+    {0xF3B2C16C, 0xE574E7EF, 0x0481, 2},
+    {0xF3B322AE, 0x6D8CCCBF, 0x0A71, 1},
+    {0xF4ACD5D8, 0xECFD4AE9, 0x46EA, 1},
+    {0xF57E9024, 0xDA0EAC1F, 0x0AF3, 1},
+    {0xF6A6604A, 0x076B9B6F, 0x0AF3, 4},
+    {0xF6A6604A, 0x076B9B6F, 0x0A71, 2},
+    {0xF6A6604A, 0x076B9B6F, 0x1975, 1},
+    {0xF743C641, 0x5BEDCF1F, 0x0AF3, 1},
+    {0xFA1357A8, 0x4E3A4A65, 0x0481, 5},
+    {0xFA1357A8, 0x4E3A4A65, 0x0546, 1},
+    {0xFA1357A8, 0x4E3A4A65, 0x054D, 1},
+    {0xFA3658A5, 0x92DC849F, 0x18F3, 1},
+    {0xFAB21B90, 0x77FB924A, 0x0481, 1},
+    {0xFE209C2E, 0xF673B301, 0x0B34, 2},
+    {0xFE209C2E, 0xF673B301, 0x0B7E, 2},
+    {0xFE209C2E, 0xF673B301, 0x0AF3, 1},
+    {0xFEB8AB9E, 0xFF3234A4, 0x16CB, 1},
+    {0xFFB0DFBB, 0x78C58477, 0x02C2, 1},
+};
+
+#endif
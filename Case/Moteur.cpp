@@ -0,0 +1,537 @@
+#include <Moteur.h>
+#include <Finales.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Valeur de chaque type de piece en centiemes de pion. Voir TypePiece
+static const int16_t VALEURS[AUCUNE] = {100, 320, 330, 500, 900, 0};
+
+// Bonus de chaque case pour une piece blanche, la rangee 0 en premier. Une piece noire lit la case (position ^ 56)
+// Les tables sont symetriques entre les colonnes : l'inversion des colonnes du Board (voir Fen.h) n'y change rien
+static const int8_t TABLES[AUCUNE][64] = {
+    // Pion
+    {0, 0, 0, 0, 0, 0, 0, 0,
+     5, 10, 10, -20, -20, 10, 10, 5,
+     5, -5, -10, 0, 0, -10, -5, 5,
+     0, 0, 0, 20, 20, 0, 0, 0,
+     5, 5, 10, 25, 25, 10, 5, 5,
+     10, 10, 20, 30, 30, 20, 10, 10,
+     50, 50, 50, 50, 50, 50, 50, 50,
+     0, 0, 0, 0, 0, 0, 0, 0},
+    // Cavalier
+    {-50, -40, -30, -30, -30, -30, -40, -50,
+     -40, -20, 0, 5, 5, 0, -20, -40,
+     -30, 5, 10, 15, 15, 10, 5, -30,
+     -30, 0, 15, 20, 20, 15, 0, -30,
+     -30, 5, 15, 20, 20, 15, 5, -30,
+     -30, 0, 10, 15, 15, 10, 0, -30,
+     -40, -20, 0, 0, 0, 0, -20, -40,
+     -50, -40, -30, -30, -30, -30, -40, -50},
+    // Fou
+    {-20, -10, -10, -10, -10, -10, -10, -20,
+     -10, 5, 0, 0, 0, 0, 5, -10,
+     -10, 10, 10, 10, 10, 10, 10, -10,
+     -10, 0, 10, 10, 10, 10, 0, -10,
+     -10, 5, 5, 10, 10, 5, 5, -10,
+     -10, 0, 5, 10, 10, 5, 0, -10,
+     -10, 0, 0, 0, 0, 0, 0, -10,
+     -20, -10, -10, -10, -10, -10, -10, -20},
+    // Tour
+    {0, 0, 0, 5, 5, 0, 0, 0,
+     -5, 0, 0, 0, 0, 0, 0, -5,
+     -5, 0, 0, 0, 0, 0, 0, -5,
+     -5, 0, 0, 0, 0, 0, 0, -5,
+     -5, 0, 0, 0, 0, 0, 0, -5,
+     -5, 0, 0, 0, 0, 0, 0, -5,
+     5, 10, 10, 10, 10, 10, 10, 5,
+     0, 0, 0, 0, 0, 0, 0, 0},
+    // Reine
+    {-20, -10, -10, -5, -5, -10, -10, -20,
+     -10, 0, 0, 0, 0, 0, 0, -10,
+     -10, 0, 5, 5, 5, 5, 0, -10,
+     -5, 0, 5, 5, 5, 5, 0, -5,
+     -5, 0, 5, 5, 5, 5, 0, -5,
+     -10, 0, 5, 5, 5, 5, 0, -10,
+     -10, 0, 0, 0, 0, 0, 0, -10,
+     -20, -10, -10, -5, -5, -10, -10, -20},
+    // Roi, en milieu de partie : a l'abri derriere ses pions
+    {20, 30, 10, 0, 0, 10, 30, 20,
+     20, 20, 0, 0, 0, 0, 20, 20,
+     -10, -20, -20, -20, -20, -20, -20, -10,
+     -20, -30, -30, -40, -40, -30, -30, -20,
+     -30, -40, -40, -50, -50, -40, -40, -30,
+     -30, -40, -40, -50, -50, -40, -40, -30,
+     -30, -40, -40, -50, -50, -40, -40, -30,
+     -30, -40, -40, -50, -50, -40, -40, -30}};
+
+// Roi en finale : au centre
+static const int8_t ROI_FINALE[64] = {
+    -50, -30, -30, -30, -30, -30, -30, -50,
+    -30, -30, 0, 0, 0, 0, -30, -30,
+    -30, -10, 20, 30, 30, 20, -10, -30,
+    -30, -10, 30, 40, 40, 30, -10, -30,
+    -30, -10, 30, 40, 40, 30, -10, -30,
+    -30, -10, 20, 30, 30, 20, -10, -30,
+    -30, -20, -10, 0, 0, -10, -20, -30,
+    -50, -40, -30, -20, -20, -30, -40, -50};
+
+#define MATERIEL_FINALE 1660 // Pieces (sans les pions ni les rois) des deux joueurs sous lequel la partie est une finale
+#define SCORE_MAT_LOINTAIN (SCORE_MAT - PLY_MAX) // Tout score au-dela est un mat
+#define SCORE_FINALE 20000                       // Score d'une finale gagnee d'apres les tables, sous les mats
+#define PROGRES_FINALE 2000                      // Ecart entre deux finales gagnees (KPK, KRK, KQK) : plus que tout bonus de progres
+
+// Constructeur. millis : temps en millisecondes. ceder : laisse rouler les autres taches
+Moteur::Moteur(uint32_t (*millis)(), void (*ceder)()) : _millis(millis), _ceder(ceder)
+{
+  vider();
+}
+
+// Efface la table de transposition et les coups "killer". A faire avant une nouvelle partie
+void Moteur::vider()
+{
+  memset(_table, 0, sizeof(_table));
+  memset(_killers, 0, sizeof(_killers));
+}
+
+// Cherche le meilleur coup du joueur qui a le trait, en au plus 'budget' millisecondes (0 : sans limite de temps)
+// et au plus 'profondeurMax' demi-coups (0 : sans limite). Sans limite de temps, la recherche ne depend pas de l'horloge
+// 'historique' : cles des 'positions' dernieres positions de la partie avant 'plateau', la plus vieille en premier
+// Une profondeur n'est commencee que si la moitie du budget n'est pas encore ecoulee : elle a peu de chances de finir
+ResultatRecherche Moteur::chercher(const Board &plateau, uint32_t budget, uint8_t profondeurMax, const uint64_t *historique, uint8_t positions)
+{
+  ResultatRecherche resultat = {COUP_NUL, 0, 0, 0, 0};
+
+  _debut = _millis();
+  _budget = budget;
+  _noeuds = 0;
+  _arret = false;
+  _positions = (positions > HISTORIQUE_MAX) ? HISTORIQUE_MAX : positions;
+  if (_positions)
+  {
+    memcpy(_chemin, historique + positions - _positions, _positions * sizeof(uint64_t));
+  }
+  memset(_killers, 0, sizeof(_killers));
+
+  for (int profondeur = 1; profondeur < PLY_MAX / 2 && (!profondeurMax || profondeur <= profondeurMax); profondeur++)
+  {
+    int score;
+
+    _meilleurRacine = COUP_NUL;
+    score = alphaBeta(plateau, profondeur, 0, -SCORE_INFINI, SCORE_INFINI);
+    if (_arret)
+    {
+      break;
+    }
+
+    resultat.coup = _meilleurRacine;
+    resultat.score = score;
+    resultat.profondeur = profondeur;
+    if (score >= SCORE_MAT_LOINTAIN || score <= -SCORE_MAT_LOINTAIN || (_budget && _millis() - _debut >= _budget / 2))
+    {
+      break;
+    }
+  }
+
+  // Budget epuise avant la fin de la profondeur 1 : le premier coup legal
+  if (resultat.coup == COUP_NUL)
+  {
+    int nombre = ordonner(plateau, _coups[0], plateau.genererCoups(plateau.getTrait(), _coups[0]), COUP_NUL, 0, false);
+
+    resultat.coup = nombre ? _coups[0][0] : COUP_NUL;
+  }
+  resultat.noeuds = _noeuds;
+  resultat.duree = _millis() - _debut;
+  return resultat;
+}
+
+// Retourne l'evaluation statique de la position, du point de vue du joueur qui a le trait
+// Materiel et bonus des cases (voir TABLES). Le roi change de table quand il reste peu de pieces
+int Moteur::evaluer(const Board &plateau)
+{
+  int score = 0;    // Du point de vue des blancs
+  int materiel = 0; // Pieces des deux joueurs, sans les pions ni les rois
+
+  for (short joueur = 1; joueur >= -1; joueur -= 2)
+  {
+    for (short type = PION; type < ROI; type++)
+    {
+      uint64_t pieces = plateau.pieces(Board::symbolePiece(type), joueur);
+
+      while (pieces)
+      {
+        short position = extraireCase(pieces);
+
+        score += joueur * (VALEURS[type] + TABLES[type][joueur > 0 ? position : position ^ 56]);
+        if (type != PION)
+        {
+          materiel += VALEURS[type];
+        }
+      }
+    }
+  }
+
+  for (short joueur = 1; joueur >= -1; joueur -= 2)
+  {
+    short roi = plateau.roi(joueur);
+
+    if (roi >= 0)
+    {
+      short position = joueur > 0 ? roi : roi ^ 56;
+      score += joueur * (materiel <= MATERIEL_FINALE ? ROI_FINALE[position] : TABLES[ROI][position]);
+    }
+  }
+
+  return plateau.getTrait() * score;
+}
+
+// Retourne la distance de Manhattan d'une case au centre : 0 sur les 4 cases du centre, 6 dans un coin
+static int distanceCentre(short position)
+{
+  short rangee = position / TAILLE;
+  short colonne = position % TAILLE;
+
+  return (rangee < 4 ? 3 - rangee : rangee - 4) + (colonne < 4 ? 3 - colonne : colonne - 4);
+}
+
+// Retourne le nombre de cases ou la tour (ou la dame) enferme le roi faible : le rectangle du cote du roi
+// delimite par la rangee et la colonne de la piece. 64 si la piece ne le separe de rien
+static int boite(short piece, short roiFaible)
+{
+  short r = piece / TAILLE, c = piece % TAILLE;
+  short rf = roiFaible / TAILLE, cf = roiFaible % TAILLE;
+  int rangees = (rf > r) ? TAILLE - 1 - r : (rf < r) ? r : TAILLE;
+  int colonnes = (cf > c) ? TAILLE - 1 - c : (cf < c) ? c : TAILLE;
+
+  return rangees * colonnes;
+}
+
+// Retourne vrai si la position est dans une table de finales (voir Finales.h), avec 'score' du point de vue du joueur qui a le trait
+// Nulle : 0. Gain : SCORE_FINALE plus un bonus de progres, qui change a chaque bon coup puisque les tables ne donnent pas
+// la distance au mat. Roi et pion : pion avance, roi faible loin du centre, rois proches. Roi et tour ou dame :
+// roi faible pousse vers un coin, enferme dans une petite boite par la piece, et roi fort qui s'en approche
+static bool scoreFinale(const Board &plateau, int &score)
+{
+  short gagnant;
+  TypeFinale finale = sonderFinale(plateau, gagnant);
+
+  if (finale == FINALE_AUCUNE)
+  {
+    return false;
+  }
+  if (gagnant == 0)
+  {
+    score = 0;
+    return true;
+  }
+
+  short roiFort = plateau.roi(gagnant);
+  short roiFaible = plateau.roi(-gagnant);
+  uint64_t pieces = plateau.pieces(gagnant) & ~bitCase(roiFort);
+  short piece = extraireCase(pieces);
+  int dr = abs(roiFort / TAILLE - roiFaible / TAILLE);
+  int dc = abs(roiFort % TAILLE - roiFaible % TAILLE);
+  int progres;
+
+  if (finale == FINALE_KPK)
+  {
+    short rangee = (gagnant > 0) ? piece / TAILLE : TAILLE - 1 - piece / TAILLE;
+    progres = 20 * rangee - ROI_FINALE[gagnant < 0 ? roiFaible : roiFaible ^ 56] - 10 * (dr > dc ? dr : dc);
+  }
+  else
+  {
+    progres = 50 * distanceCentre(roiFaible) + 20 * (14 - dr - dc) + 5 * (64 - boite(piece, roiFaible));
+  }
+  // La dame vaut mieux que la tour, qui vaut mieux que le pion le plus avance : la promotion est toujours un progres
+  score = plateau.getTrait() * gagnant * (SCORE_FINALE + PROGRES_FINALE * finale + progres);
+  return true;
+}
+
+// Recherche alpha-beta (negamax) a 'profondeur' demi-coups. Retourne le score du joueur qui a le trait
+// Un roi en echec prolonge la recherche d'un demi-coup. Une position repetee est nulle
+int Moteur::alphaBeta(const Board &plateau, int profondeur, int ply, int alpha, int beta)
+{
+  short joueur = plateau.getTrait();
+  bool echec = plateau.echecs(joueur) != 0;
+  uint64_t cle = plateau.cle();
+  EntreeTransposition &entree = _table[cle & (ENTREES_TRANSPOSITION - 1)];
+  Coup premier = COUP_NUL; // Coup a essayer en premier
+  int alphaDepart = alpha;
+  int meilleurScore = -SCORE_INFINI;
+  Coup meilleur = COUP_NUL;
+
+  if (ply > 0 && repetition(cle, ply))
+  {
+    return 0;
+  }
+  _chemin[_positions + ply] = cle;
+
+  if (echec)
+  {
+    profondeur++;
+  }
+  if (profondeur <= 0 || ply >= PLY_MAX - 1)
+  {
+    return quiescence(plateau, ply, alpha, beta);
+  }
+
+  compter();
+  if (_arret)
+  {
+    return 0;
+  }
+
+  if (entree.verification == (uint32_t)(cle >> 32))
+  {
+    int score = entree.score;
+
+    // Un mat est garde par rapport au noeud de l'entree, et non a la racine
+    score += (score >= SCORE_MAT_LOINTAIN) ? -ply : (score <= -SCORE_MAT_LOINTAIN) ? ply : 0;
+    premier = entree.coup;
+    if (ply > 0 && entree.profondeur >= profondeur &&
+        (entree.borne == BORNE_EXACTE || (entree.borne == BORNE_BASSE && score >= beta) || (entree.borne == BORNE_HAUTE && score <= alpha)))
+    {
+      return score;
+    }
+  }
+
+  Coup *coups = _coups[ply];
+  int nombre = ordonner(plateau, coups, plateau.genererCoups(joueur, coups), premier, ply, false);
+
+  if (nombre == 0)
+  {
+    return echec ? -SCORE_MAT + ply : 0; // Mat ou pat
+  }
+
+  // Une finale nulle d'apres les tables n'est pas cherchee plus loin. Une finale gagnee l'est, pour trouver le mat
+  int finale;
+  if (ply > 0 && scoreFinale(plateau, finale) && finale == 0)
+  {
+    return 0;
+  }
+
+  for (int i = 0; i < nombre; i++)
+  {
+    Board suivant = plateau;
+    int score;
+
+    suivant.jouer(coups[i]);
+    score = -alphaBeta(suivant, profondeur - 1, ply + 1, -beta, -alpha);
+    if (_arret)
+    {
+      return 0;
+    }
+
+    if (score > meilleurScore)
+    {
+      meilleurScore = score;
+      meilleur = coups[i];
+      if (ply == 0)
+      {
+        _meilleurRacine = meilleur;
+      }
+    }
+    if (score > alpha)
+    {
+      alpha = score;
+    }
+    if (alpha >= beta)
+    {
+      if (!estCapture(coups[i]) && _killers[ply][0] != coups[i])
+      {
+        _killers[ply][1] = _killers[ply][0];
+        _killers[ply][0] = coups[i];
+      }
+      break;
+    }
+  }
+
+  entree.verification = (uint32_t)(cle >> 32);
+  entree.score = meilleurScore + ((meilleurScore >= SCORE_MAT_LOINTAIN) ? ply : (meilleurScore <= -SCORE_MAT_LOINTAIN) ? -ply : 0);
+  entree.coup = meilleur;
+  entree.profondeur = profondeur;
+  entree.borne = (meilleurScore <= alphaDepart) ? BORNE_HAUTE : (meilleurScore >= beta) ? BORNE_BASSE : BORNE_EXACTE;
+  return meilleurScore;
+}
+
+// Continue les captures et les promotions jusqu'a une position calme
+// Le joueur peut toujours s'arreter au score statique : il n'est pas oblige de capturer
+int Moteur::quiescence(const Board &plateau, int ply, int alpha, int beta)
+{
+  short joueur = plateau.getTrait();
+  int statique;
+
+  compter();
+  if (_arret)
+  {
+    return 0;
+  }
+
+  // Aux feuilles, les tables de finales remplacent l'evaluation statique. Le mat et le pat sont reconnus avant :
+  // les tables ne les distinguent pas d'une autre finale gagnee ou nulle
+  short fort;
+  if (typeFinale(plateau, fort) != FINALE_AUCUNE && plateau.genererCoups(joueur, _coups[ply]) == 0)
+  {
+    return plateau.echecs(joueur) ? -SCORE_MAT + ply : 0;
+  }
+  if (scoreFinale(plateau, statique))
+  {
+    return statique;
+  }
+
+  statique = evaluer(plateau);
+  if (statique >= beta || ply >= PLY_MAX - 1)
+  {
+    return statique;
+  }
+  if (statique > alpha)
+  {
+    alpha = statique;
+  }
+
+  Coup *coups = _coups[ply];
+  int total = plateau.genererCoups(joueur, coups);
+
+  if (total == 0)
+  {
+    return plateau.echecs(joueur) ? -SCORE_MAT + ply : 0;
+  }
+
+  int nombre = ordonner(plateau, coups, total, COUP_NUL, ply, true);
+  for (int i = 0; i < nombre; i++)
+  {
+    Board suivant = plateau;
+    int score;
+
+    suivant.jouer(coups[i]);
+    score = -quiescence(suivant, ply + 1, -beta, -alpha);
+    if (_arret)
+    {
+      return 0;
+    }
+    if (score >= beta)
+    {
+      return score;
+    }
+    if (score > alpha)
+    {
+      alpha = score;
+    }
+  }
+  return alpha;
+}
+
+// Compte un noeud. Tous les NOEUDS_VERIFICATION noeuds, lit l'horloge et cede le processeur
+void Moteur::compter()
+{
+  _noeuds++;
+  if ((_noeuds & (NOEUDS_VERIFICATION - 1)) == 0)
+  {
+    if (_budget && _millis() - _debut >= _budget)
+    {
+      _arret = true;
+    }
+    _ceder();
+  }
+}
+
+// Indique si la position 'cle', au niveau 'ply' de la recherche, est deja apparue dans la partie ou sur le chemin
+// Seules les positions ou le meme joueur avait le trait sont comparees : une sur deux en remontant
+bool Moteur::repetition(uint64_t cle, int ply) const
+{
+  for (int i = _positions + ply - 2; i >= 0; i -= 2)
+  {
+    if (_chemin[i] == cle)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Retire les coups qui ne seront pas essayes et range les autres dans l'ordre de la recherche :
+// 'premier', captures et promotions (meilleure valeur en premier), coups "killer", puis les autres
+// capturesSeulement : garde seulement les captures et les promotions (quiescence). Retourne le nombre de coups gardes
+int Moteur::ordonner(const Board &plateau, Coup *coups, int nombre, Coup premier, int ply, bool capturesSeulement)
+{
+  int gardes = 0;
+  int debut = 0;    // Premier coup apres 'premier'
+  int captures;     // Premier coup apres les captures, puis apres les coups "killer"
+  Coup echange;
+
+  for (int i = 0; i < nombre; i++)
+  {
+    Coup coup = coups[i];
+
+    if ((estPromotion(coup) && promotionCoup(coup) != REINE) || (capturesSeulement && !estCapture(coup) && !estPromotion(coup)))
+    {
+      continue;
+    }
+    coups[gardes++] = coup;
+  }
+
+  for (int i = 0; premier != COUP_NUL && i < gardes; i++)
+  {
+    if (coups[i] == premier)
+    {
+      coups[i] = coups[0];
+      coups[0] = premier;
+      debut = 1;
+      break;
+    }
+  }
+
+  // Captures et promotions au debut, triees par insertion : il y en a peu
+  captures = debut;
+  for (int i = debut; i < gardes; i++)
+  {
+    if (estCapture(coups[i]) || estPromotion(coups[i]))
+    {
+      int valeur = valeurCapture(plateau, coups[i]);
+      int j;
+
+      echange = coups[i];
+      coups[i] = coups[captures]; // Le coup calme a cette place prend celle de la capture
+      for (j = captures; j > debut && valeurCapture(plateau, coups[j - 1]) < valeur; j--)
+      {
+        coups[j] = coups[j - 1];
+      }
+      coups[j] = echange;
+      captures++;
+    }
+  }
+
+  // Coups "killer" juste apres les captures
+  for (int k = 0; k < 2; k++)
+  {
+    for (int i = captures; i < gardes && _killers[ply][k] != COUP_NUL; i++)
+    {
+      if (coups[i] == _killers[ply][k])
+      {
+        echange = coups[i];
+        coups[i] = coups[captures];
+        coups[captures++] = echange;
+        break;
+      }
+    }
+  }
+  return gardes;
+}
+
+// Retourne la valeur d'une capture pour l'ordre des coups : la victime la plus chere d'abord,
+// prise par l'attaquant le moins cher. Une promotion vaut une reine de plus
+int Moteur::valeurCapture(const Board &plateau, Coup coup)
+{
+  uint8_t victime = plateau.getOctet(arriveeCoup(coup)) & OCTET_TYPE; // Type + 1. 0 : prise en passant ou aucune
+  uint8_t attaquant = plateau.getOctet(departCoup(coup)) & OCTET_TYPE;
+  int valeur = 0;
+
+  if (estCapture(coup))
+  {
+    valeur = (victime ? victime : PION + 1) * 8 - attaquant;
+  }
+  if (estPromotion(coup))
+  {
+    valeur += (REINE + 1) * 8;
+  }
+  return valeur;
+}
@@ -0,0 +1,96 @@
+/*
+Moteur.h - Adversaire : recherche alpha-beta a approfondissement iteratif avec un budget de temps strict
+La recherche recommence a la profondeur 1, puis 2, 3... tant que le budget le permet, et garde le meilleur coup
+de la derniere profondeur terminee. Les coups sont essayes dans cet ordre : coup de la table de transposition,
+captures (victime la plus chere, attaquant le moins cher), coups "killer" qui ont coupe a la meme profondeur,
+puis les autres. Aux feuilles, la quiescence continue les captures jusqu'a une position calme.
+La position est copiee a chaque noeud (Board::jouer sur une copie) : rien a defaire, et la pile reste petite
+parce que les listes de coups sont gardees dans le Moteur et non sur la pile.
+Le moteur ne connait pas le materiel : il lit le temps et cede le processeur par deux fonctions donnees
+a sa construction. L'horloge est lue, et le processeur cede, tous les NOEUDS_VERIFICATION noeuds.
+Les finales roi et pion, roi et tour, roi et dame contre roi sont lues dans les tables (Finales.h) : une nulle
+arrete la recherche, une finale gagnee vaut SCORE_FINALE plus un bonus de progres vers le mat aux feuilles,
+apres le mat et le pat.
+Une position deja vue dans la partie (voir 'historique') ou plus haut dans la recherche est une nulle par repetition.
+La recherche peut aussi etre limitee en profondeur, sans limite de temps : le meme coup est alors trouve a chaque fois.
+Seules les promotions en reine sont jouees, comme sur l'echiquier.
+*/
+
+#ifndef Moteur_h
+
+#define Moteur_h
+
+#include <stdint.h>
+#include <Board.h>
+
+#define ENTREES_TRANSPOSITION 2048 // Entrees de la table de transposition. Puissance de 2. 12 octets chacune : 24 Ko
+#define PLY_MAX 32                 // Profondeur maximale, quiescence comprise
+#define NOEUDS_VERIFICATION 512    // Noeuds entre deux lectures de l'horloge. Puissance de 2
+#define SCORE_MAT 30000            // Score d'un mat immediat. Un mat plus lointain vaut SCORE_MAT - distance
+#define SCORE_INFINI 32000
+#define HISTORIQUE_MAX 100         // Positions de la partie gardees pour les repetitions, les plus recentes
+
+// Structure. Resultat d'une recherche
+struct ResultatRecherche
+{
+  Coup coup;          // Meilleur coup. COUP_NUL si le joueur n'a aucun coup legal
+  int16_t score;      // En centiemes de pion, du point de vue du joueur qui joue
+  uint8_t profondeur; // Derniere profondeur terminee
+  uint32_t noeuds;    // Noeuds visites, quiescence comprise
+  uint32_t duree;     // Millisecondes
+};
+
+// Structure. Une entree de la table de transposition
+struct EntreeTransposition
+{
+  uint32_t verification; // 32 bits du haut de la cle Zobrist. L'index vient des bits du bas
+  int16_t score;
+  Coup coup;             // Meilleur coup trouve, essaye en premier a la prochaine visite
+  int8_t profondeur;
+  uint8_t borne;         // BORNE_EXACTE, BORNE_BASSE ou BORNE_HAUTE
+};
+
+// Objet. Cherche le meilleur coup d'une position
+class Moteur
+{
+public:
+  Moteur(uint32_t (*millis)(), void (*ceder)());
+
+  ResultatRecherche chercher(const Board &plateau, uint32_t budget, uint8_t profondeurMax = 0,
+                             const uint64_t *historique = nullptr, uint8_t positions = 0);
+  void vider();
+
+  static int evaluer(const Board &plateau);
+
+private:
+  enum Borne : uint8_t
+  {
+    BORNE_EXACTE,
+    BORNE_BASSE, // Le score est au moins celui de l'entree (coupure beta)
+    BORNE_HAUTE  // Le score est au plus celui de l'entree (aucun coup n'a depasse alpha)
+  };
+
+  // Un _ devant une variable indique que celle-ci est propre a une instance de type Moteur
+
+  uint32_t (*_millis)();                              // Temps en millisecondes
+  void (*_ceder)();                                   // Laisse rouler les autres taches
+  EntreeTransposition _table[ENTREES_TRANSPOSITION];  // Table de transposition, gardee d'une recherche a l'autre
+  Coup _coups[PLY_MAX][MAX_COUPS];                    // Coups de chaque niveau de la recherche
+  Coup _killers[PLY_MAX][2];                          // Coups calmes qui ont coupe a chaque niveau
+  Coup _meilleurRacine;                               // Meilleur coup de la profondeur en cours
+  uint32_t _noeuds;                                   // Noeuds de la recherche en cours
+  uint32_t _debut;                                    // Debut de la recherche (voir _millis)
+  uint32_t _budget;                                   // Millisecondes permises. 0 : sans limite de temps
+  uint64_t _chemin[HISTORIQUE_MAX + PLY_MAX];         // Cles des positions de la partie, puis de la recherche en cours
+  uint8_t _positions;                                 // Positions de la partie dans '_chemin' : la racine est a cet index
+  bool _arret;                                        // Le budget est epuise : la recherche remonte sans rien garder
+
+  int alphaBeta(const Board &plateau, int profondeur, int ply, int alpha, int beta);
+  int quiescence(const Board &plateau, int ply, int alpha, int beta);
+  void compter();
+  bool repetition(uint64_t cle, int ply) const;
+  int ordonner(const Board &plateau, Coup *coups, int nombre, Coup premier, int ply, bool capturesSeulement);
+  static int valeurCapture(const Board &plateau, Coup coup);
+};
+
+#endif
@@ -0,0 +1,95 @@
+#include <Pgn.h>
+#include <Fen.h>
+#include <string.h>
+
+// Ecrit 'coup', joue dans la position de 'plateau', en notation algebrique standard dans 'san'
+// taille : taille du tampon. TAILLE_SAN suffit pour tout coup
+// Le coup doit etre legal dans cette position. Le plateau n'est pas modifie
+// Retourne le nombre de caracteres ecrits, sans le '\0'
+int ecrireSan(const Board &plateau, Coup coup, char *san, int taille)
+{
+  char tampon[TAILLE_SAN + 4];
+  int n = 0;
+  short depart = departCoup(coup);
+  short arrivee = arriveeCoup(coup);
+  short joueur = plateau.getJoueur(depart);
+  char piece = plateau.getPiece(depart);
+
+  if (estRoque(coup))
+  {
+    // Le petit roque est du cote de la colonne 0, la colonne 'h' (voir Fen.h)
+    strcpy(tampon, drapeauxCoup(coup) == COUP_PETIT_ROQUE ? "O-O" : "O-O-O");
+    n = strlen(tampon);
+  }
+  else
+  {
+    if (piece != 'P')
+    {
+      Coup coups[MAX_COUPS];
+      int nombre = plateau.genererCoups(joueur, coups, plateau.pieces(piece, joueur));
+      bool ambigu = false;   // Une autre piece du meme type peut aller sur la case d'arrivee
+      bool colonne = false;  // Une de ces pieces est sur la meme colonne
+      bool rangee = false;   // Une de ces pieces est sur la meme rangee
+
+      for (int i = 0; i < nombre; i++)
+      {
+        short autre = departCoup(coups[i]);
+
+        if (arriveeCoup(coups[i]) != arrivee || autre == depart)
+        {
+          continue;
+        }
+        ambigu = true;
+        colonne |= autre % TAILLE == depart % TAILLE;
+        rangee |= autre / TAILLE == depart / TAILLE;
+      }
+
+      tampon[n++] = piece;
+      // Lettre de la colonne si elle suffit, sinon chiffre de la rangee, sinon les deux
+      if (ambigu && (!colonne || rangee))
+      {
+        tampon[n++] = lettreFen(depart % TAILLE);
+      }
+      if (ambigu && colonne)
+      {
+        tampon[n++] = '1' + depart / TAILLE;
+      }
+    }
+    else if (estCapture(coup))
+    {
+      tampon[n++] = lettreFen(depart % TAILLE);
+    }
+
+    if (estCapture(coup))
+    {
+      tampon[n++] = 'x';
+    }
+    tampon[n++] = lettreFen(arrivee % TAILLE);
+    tampon[n++] = '1' + arrivee / TAILLE;
+
+    if (estPromotion(coup))
+    {
+      tampon[n++] = '=';
+      tampon[n++] = Board::symbolePiece(promotionCoup(coup));
+    }
+  }
+
+  // Echec ou echec et mat, lus apres avoir joue le coup sur une copie
+  Board apres = plateau;
+  Coup reponses[MAX_COUPS];
+
+  apres.jouer(coup);
+  if (apres.echecs(-joueur))
+  {
+    tampon[n++] = apres.genererCoups(-joueur, reponses) ? '+' : '#';
+  }
+  tampon[n] = '\0';
+
+  if (taille <= 0)
+  {
+    return 0;
+  }
+  strncpy(san, tampon, taille - 1);
+  san[taille - 1] = '\0';
+  return (n < taille - 1) ? n : taille - 1;
+}
@@ -0,0 +1,19 @@
+/*
+Pgn.h - Ecriture des coups en notation algebrique standard (SAN) pour les parties PGN
+Ex : e4, Nxd5, exd6, O-O, e8=Q+, Qh5#
+Un coup est converti avec la position ou il est joue : la piece deplacee, l'ambiguite entre deux pieces
+du meme type et l'echec sont lus sur le Board. Une partie est donc exportee coup par coup,
+en rejouant le journal sur un seul Board, sans garder la partie en memoire.
+*/
+
+#ifndef Pgn_h
+
+#define Pgn_h
+
+#include <Board.h>
+
+#define TAILLE_SAN 8 // Taille maximale d'un coup SAN, incluant le '\0' (ex : Qa1xb2+ ou exd8=Q#)
+
+int ecrireSan(const Board &plateau, Coup coup, char *san, int taille);
+
+#endif
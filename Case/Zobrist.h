@@ -0,0 +1,65 @@
+/*
+Zobrist.h - Nombres aleatoires pour la cle de hachage d'une position
+La cle d'une position est le OU exclusif des nombres de chaque element present :
+une piece d'un joueur sur une case, le trait au joueur noir, les droits de roque et la case de prise en passant.
+Changer une case ne demande donc qu'un OU exclusif pour retirer l'ancien element et un pour ajouter le nouveau.
+Les nombres sont generes a la compilation (constexpr) avec un generateur splitmix64 a graine fixe :
+une meme position donne toujours la meme cle, sur l'ESP32 comme sur un ordinateur.
+*/
+
+#ifndef Zobrist_h
+
+#define Zobrist_h
+
+#include <stdint.h>
+
+// Structure. Nombres aleatoires de chaque element d'une position
+struct TableZobrist
+{
+  uint64_t pieces[12][64]; // Type de piece (0 a 5 pour blanc, 6 a 11 pour noir) sur chaque case
+  uint64_t roque[16];      // Droits de roque, par masque (voir Board::droitsRoque). 0 sans aucun droit
+  uint64_t passant[8];     // Colonne de la case vulnerable a une prise en passant
+  uint64_t trait;          // Le joueur noir doit jouer
+};
+
+// Avance le generateur splitmix64 et retourne le prochain nombre
+constexpr uint64_t splitmix64(uint64_t &etat)
+{
+  uint64_t z = (etat += 0x9E3779B97F4A7C15ULL);
+
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+// Genere les nombres de la table
+// Les droits de roque sont haches ensemble, et non case par case : deux positions avec les memes droits
+// ont la meme cle, meme si une tour est partie et revenue apres que son roi a bouge
+constexpr TableZobrist genererZobrist()
+{
+  TableZobrist table = {};
+  uint64_t etat = 0x45636865635F7631ULL;
+
+  for (short piece = 0; piece < 12; piece++)
+  {
+    for (short position = 0; position < 64; position++)
+    {
+      table.pieces[piece][position] = splitmix64(etat);
+    }
+  }
+  for (short droits = 1; droits < 16; droits++)
+  {
+    table.roque[droits] = splitmix64(etat);
+  }
+  for (short colonne = 0; colonne < 8; colonne++)
+  {
+    table.passant[colonne] = splitmix64(etat);
+  }
+  table.trait = splitmix64(etat);
+  return table;
+}
+
+// Nombres aleatoires de la cle de hachage
+inline constexpr TableZobrist ZOBRIST = genererZobrist();
+
+#endif
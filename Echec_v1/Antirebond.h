@@ -0,0 +1,84 @@
+/*
+Antirebond.h - Filtre anti-rebond des 64 interrupteurs reed
+Chaque case a un compteur de lectures consecutives differentes de son etat stable. Les compteurs sont
+"verticaux" : le bit b des 64 compteurs est range dans un seul uint64_t, ce qui filtre les 64 cases a la fois
+avec quelques operations logiques par bit de compteur.
+Une case ne change d'etat qu'apres ECHANTILLONS lectures consecutives du nouvel etat. Une seule lecture
+identique a l'etat stable remet son compteur a zero : un rebond pendant le glissement d'une piece n'est jamais publie.
+*/
+
+#ifndef Antirebond_h
+
+#define Antirebond_h
+
+#include <stdint.h>
+
+// Objet. Filtre les lectures des 64 cases et ne garde que les changements stables
+// ECHANTILLONS : nombre de lectures consecutives du nouvel etat avant de changer d'etat (1 : aucun filtre)
+template <uint8_t ECHANTILLONS>
+class Antirebond
+{
+  static_assert(ECHANTILLONS >= 1, "Il faut au moins une lecture pour changer d'etat");
+
+public:
+  explicit Antirebond(uint64_t etat = 0);
+
+  uint64_t filtrer(uint64_t lecture);
+  uint64_t getEtat() const;
+
+private:
+  // Nombre de bits des compteurs : ils comptent de 0 a ECHANTILLONS - 1
+  static constexpr uint8_t BITS = (ECHANTILLONS - 1 < 2) ? 1 : (ECHANTILLONS - 1 < 4) ? 2 : (ECHANTILLONS - 1 < 8) ? 3 : (ECHANTILLONS - 1 < 16) ? 4 : 8;
+
+  // Un _ devant une variable indique que celle-ci est propre a une instance de type Antirebond
+
+  uint64_t _etat;            // Etat stable de chaque case
+  uint64_t _compteur[BITS];  // Bit b du compteur de chaque case
+};
+
+// Constructeur. 'etat' est l'etat stable de depart, habituellement une premiere lecture
+template <uint8_t ECHANTILLONS>
+Antirebond<ECHANTILLONS>::Antirebond(uint64_t etat)
+{
+  _etat = etat;
+  for (uint8_t b = 0; b < BITS; b++)
+  {
+    _compteur[b] = 0;
+  }
+}
+
+// Ajoute une lecture et retourne l'etat stable des 64 cases
+template <uint8_t ECHANTILLONS>
+uint64_t Antirebond<ECHANTILLONS>::filtrer(uint64_t lecture)
+{
+  uint64_t change = lecture ^ _etat; // Cases lues differemment de leur etat stable
+  uint64_t plein = change;           // Cases dont le compteur vaut ECHANTILLONS - 1
+
+  for (uint8_t b = 0; b < BITS; b++)
+  {
+    plein &= (((ECHANTILLONS - 1) >> b) & 1) ? _compteur[b] : ~_compteur[b];
+  }
+  _etat ^= plein;
+
+  // Incremente le compteur des cases qui changent encore, remet les autres a zero
+  uint64_t actif = change & ~plein;
+  uint64_t retenue = actif;
+  for (uint8_t b = 0; b < BITS; b++)
+  {
+    uint64_t bit = _compteur[b];
+
+    _compteur[b] = (bit ^ retenue) & actif;
+    retenue &= bit;
+  }
+
+  return _etat;
+}
+
+// Retourne l'etat stable des 64 cases
+template <uint8_t ECHANTILLONS>
+uint64_t Antirebond<ECHANTILLONS>::getEtat() const
+{
+  return _etat;
+}
+
+#endif
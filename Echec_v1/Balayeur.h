@@ -0,0 +1,286 @@
+/*
+Balayeur.h - Lecture des 64 interrupteurs reed a travers les 4 multiplexeurs
+Pour chaque case, les 4 lignes de selection (S0 a S3) et les 4 lignes d'activation des multiplexeurs
+sont ecrites en un seul acces aux registres du GPIO (voir Gpio::ecrireMasque), a partir d'une table
+de masques generee a la compilation. Les canaux sont parcourus en code de Gray : une seule ligne de selection
+change d'une case a l'autre, et le sens s'inverse a chaque multiplexeur pour que le passage au suivant
+ne change que les lignes d'activation.
+Chaque entree des multiplexeurs a son propre temps de stabilisation, mesure par calibrer() et garde en NVS.
+Les balayages sont cadences par l'horloge : un balayage complet toutes les PERIODE_BALAYAGE_MS.
+Le mot lu a le meme format que l'ancien LectureTableau() : l'entree (16 * multiplexeur + canal) est le bit 63 - entree.
+*/
+
+#ifndef Balayeur_h
+
+#define Balayeur_h
+
+#include <stdint.h>
+#include "Definition.h"
+
+#define STABILISATION_CALIBRATION_US 50 // Attente ou toutes les entrees sont certainement stables. Sert de reference
+#define ESSAIS_CALIBRATION 16           // Nombre de lectures identiques pour accepter un temps de stabilisation
+#define MARGE_STABILISATION_US 1        // Ajoutee au temps mesure (temperature, vieillissement des interrupteurs)
+#define CLE_STABILISATION "stab_mux"    // Cle NVS des temps de stabilisation
+
+// Structure. Les broches a mettre a HIGH et a LOW pour lire chacune des 64 cases, dans l'ordre du balayage
+// 'entree' est l'entree lue a chaque etape : 16 * multiplexeur + canal
+struct MasquesBalayage
+{
+  uint32_t haut[64];
+  uint32_t bas[64];
+  uint8_t entree[64];
+};
+
+// Genere les masques de chaque etape du balayage a partir des broches de Definition.h
+// Le multiplexeur (etape / 16) est actif sur un LOW. Son canal est le code de Gray du rang de l'etape,
+// parcouru a l'envers pour les multiplexeurs impairs
+constexpr MasquesBalayage genererMasques()
+{
+  MasquesBalayage table = {};
+  const uint8_t selection[4] = {MUX_S0, MUX_S1, MUX_S2, MUX_S3};
+  const uint8_t activation[4] = {MUX1_E, MUX2_E, MUX3_E, MUX4_E};
+
+  for (short i = 0; i < 64; i++)
+  {
+    short multiplexeur = i / 16;
+    short rang = (multiplexeur % 2) ? 15 - i % 16 : i % 16;
+    short canal = rang ^ (rang >> 1);
+
+    table.entree[i] = 16 * multiplexeur + canal;
+    for (short ligne = 0; ligne < 4; ligne++)
+    {
+      if (canal & (1 << ligne))
+      {
+        table.haut[i] |= 1UL << selection[ligne];
+      }
+      else
+      {
+        table.bas[i] |= 1UL << selection[ligne];
+      }
+
+      if (ligne == multiplexeur)
+      {
+        table.bas[i] |= 1UL << activation[ligne];
+      }
+      else
+      {
+        table.haut[i] |= 1UL << activation[ligne];
+      }
+    }
+  }
+  return table;
+}
+
+static_assert(MUX_S0 < 32 && MUX_S1 < 32 && MUX_S2 < 32 && MUX_S3 < 32 && MUX1_E < 32 && MUX2_E < 32 && MUX3_E < 32 && MUX4_E < 32 && RS_DATA < 32,
+              "Les broches des multiplexeurs doivent etre dans le premier registre du GPIO (0 a 31)");
+
+// Masques de chaque etape du balayage
+inline constexpr MasquesBalayage MASQUES_BALAYAGE = genererMasques();
+
+// Objet. Balaye les 64 cases et mesure le nombre de balayages par seconde
+template <class Materiel>
+class Balayeur
+{
+public:
+  Balayeur();
+
+  uint64_t balayer();
+  void attendreProchain();
+  uint32_t balayagesParSeconde() const;
+
+  bool charger();
+  bool calibrer();
+  uint8_t getStabilisation(short entree) const;
+
+private:
+  using Horloge = typename Materiel::Horloge;
+  using Gpio = typename Materiel::Gpio;
+  using Memoire = typename Materiel::Memoire;
+
+  // Un _ devant une variable indique que celle-ci est propre a une instance de type Balayeur
+
+  uint32_t _echeance;          // Instant (millis) du prochain balayage
+  uint32_t _debut;             // Debut de la mesure en cours (millis)
+  uint32_t _compte;            // Nombre de balayages depuis _debut
+  uint32_t _rythme;            // Balayages par seconde lors de la derniere mesure
+  uint8_t _stabilisation[64];  // Temps de stabilisation de chaque entree, en microsecondes
+
+  static void selectionner(short etape);
+  static bool lireDonnees();
+  uint8_t mesurer(short etape, short source);
+};
+
+// Constructeur. Le premier balayage peut commencer tout de suite
+// Sans calibration, chaque entree attend le pire cas de STABILISATION_MUX_US
+template <class Materiel>
+Balayeur<Materiel>::Balayeur()
+{
+  _echeance = 0;
+  _debut = 0;
+  _compte = 0;
+  _rythme = 0;
+  for (short i = 0; i < 64; i++)
+  {
+    _stabilisation[i] = STABILISATION_MUX_US;
+  }
+}
+
+// Choisit l'entree de l'etape 'etape' du balayage
+// Les lignes a HIGH sont ecrites en premier : l'ancien multiplexeur est desactive avant d'activer le nouveau
+template <class Materiel>
+void Balayeur<Materiel>::selectionner(short etape)
+{
+  Gpio::ecrireMasque(MASQUES_BALAYAGE.haut[etape], MASQUES_BALAYAGE.bas[etape]);
+}
+
+// Lit la sortie commune des multiplexeurs
+template <class Materiel>
+bool Balayeur<Materiel>::lireDonnees()
+{
+  return (Gpio::lireMasque() >> RS_DATA) & 1;
+}
+
+// Lit les 64 cases et retourne leur etat sur 64 bits. 1 indique qu'une piece est sur la case
+// Pour chaque case : un acces aux registres pour choisir le canal, l'attente de stabilisation de l'entree, puis une lecture
+template <class Materiel>
+uint64_t Balayeur<Materiel>::balayer()
+{
+  uint64_t lecture = 0;
+
+  for (short i = 0; i < 64; i++)
+  {
+    uint8_t entree = MASQUES_BALAYAGE.entree[i];
+
+    selectionner(i);
+    Horloge::attendreMicros(_stabilisation[entree]);
+    lecture |= (uint64_t)lireDonnees() << (63 - entree);
+  }
+
+  // Mesure du rythme sur une fenetre d'une seconde
+  _compte++;
+  uint32_t ecoule = Horloge::millis() - _debut;
+  if (ecoule >= 1000)
+  {
+    _rythme = (uint64_t)_compte * 1000 / ecoule;
+    _compte = 0;
+    _debut += ecoule;
+  }
+
+  return lecture;
+}
+
+// Attend le debut du prochain balayage, une periode apres le precedent
+// Le coeur est laisse aux autres taches pendant l'attente. En retard d'une periode ou plus, on repart de maintenant
+template <class Materiel>
+void Balayeur<Materiel>::attendreProchain()
+{
+  uint32_t maintenant = Horloge::millis();
+
+  _echeance += PERIODE_BALAYAGE_MS;
+  if ((int32_t)(maintenant - _echeance) >= PERIODE_BALAYAGE_MS)
+  {
+    _echeance = maintenant;
+  }
+  Horloge::attendreJusqua(_echeance);
+}
+
+// Retourne le nombre de balayages complets lors de la derniere seconde
+template <class Materiel>
+uint32_t Balayeur<Materiel>::balayagesParSeconde() const
+{
+  return _rythme;
+}
+
+// Charge les temps de stabilisation de la NVS. Faux si aucune calibration n'a ete gardee
+template <class Materiel>
+bool Balayeur<Materiel>::charger()
+{
+  uint8_t lu[64];
+
+  if (!Memoire::lire(CLE_STABILISATION, lu, sizeof(lu)))
+  {
+    return false;
+  }
+  for (short i = 0; i < 64; i++)
+  {
+    _stabilisation[i] = (lu[i] < STABILISATION_MUX_US) ? lu[i] : STABILISATION_MUX_US;
+  }
+  return true;
+}
+
+// Mesure le temps de stabilisation de chaque entree et le garde en NVS
+// L'echiquier doit avoir au moins une case occupee et une case vide (ex : position de depart) : chaque entree
+// est mesuree en venant d'une entree de valeur opposee, de preference celle qui la precede dans le balayage.
+// Faux si toutes les cases ont la meme valeur. Les temps ne changent pas dans ce cas
+template <class Materiel>
+bool Balayeur<Materiel>::calibrer()
+{
+  bool valeurs[64]; // Valeur de reference de chaque etape
+  bool occupee = false, vide = false;
+
+  for (short i = 0; i < 64; i++)
+  {
+    selectionner(i);
+    Horloge::attendreMicros(STABILISATION_CALIBRATION_US);
+    valeurs[i] = lireDonnees();
+    occupee |= valeurs[i];
+    vide |= !valeurs[i];
+  }
+  if (!occupee || !vide)
+  {
+    return false;
+  }
+
+  for (short i = 0; i < 64; i++)
+  {
+    short source = (i + 63) % 64;
+
+    for (short j = 0; valeurs[source] == valeurs[i]; j++)
+    {
+      source = j;
+    }
+    _stabilisation[MASQUES_BALAYAGE.entree[i]] = mesurer(i, source);
+  }
+
+  return Memoire::ecrire(CLE_STABILISATION, _stabilisation, sizeof(_stabilisation));
+}
+
+// Retourne le plus court temps (en microsecondes) apres lequel l'etape 'etape' se lit toujours comme sa reference
+// lorsque l'on vient de l'etape 'source', plus MARGE_STABILISATION_US
+template <class Materiel>
+uint8_t Balayeur<Materiel>::mesurer(short etape, short source)
+{
+  bool reference;
+
+  selectionner(etape);
+  Horloge::attendreMicros(STABILISATION_CALIBRATION_US);
+  reference = lireDonnees();
+
+  for (uint8_t attente = 0; attente + MARGE_STABILISATION_US < STABILISATION_MUX_US; attente++)
+  {
+    bool stable = true;
+
+    for (short essai = 0; essai < ESSAIS_CALIBRATION && stable; essai++)
+    {
+      selectionner(source);
+      Horloge::attendreMicros(STABILISATION_CALIBRATION_US);
+      selectionner(etape);
+      Horloge::attendreMicros(attente);
+      stable = lireDonnees() == reference;
+    }
+    if (stable)
+    {
+      return attente + MARGE_STABILISATION_US;
+    }
+  }
+  return STABILISATION_MUX_US;
+}
+
+// Retourne le temps de stabilisation de l'entree (16 * multiplexeur + canal), en microsecondes
+template <class Materiel>
+uint8_t Balayeur<Materiel>::getStabilisation(short entree) const
+{
+  return _stabilisation[entree];
+}
+
+#endif
@@ -0,0 +1,172 @@
+/*
+Compositeur.h - Image des 64 DEL composee de couches
+Chaque fonction du jeu dessine dans sa propre couche : l'echiquier, les coups possibles, l'echec au roi,
+la piece choisie, les erreurs et la fin de partie. Une case transparente laisse voir la couche du dessous.
+afficher() superpose les couches, compare l'image avec la derniere envoyee et ne transmet le ruban
+(un seul show()) que si une DEL a change. Une fonction n'efface donc jamais les DEL d'une autre.
+*/
+
+#ifndef Compositeur_h
+
+#define Compositeur_h
+
+#include <stdint.h>
+#include <string.h>
+
+#define NOMBRE_DEL 64 // Une DEL par case
+
+// Couches de l'image, de la plus basse a la plus haute. Une couche haute cache les couches basses
+enum CoucheDel
+{
+  COUCHE_ECHIQUIER, // Cases blanches et noires
+  COUCHE_COUPS,     // Cases d'arrivee possibles de la piece soulevee
+  COUCHE_ALERTE,    // Roi en echec
+  COUCHE_SELECTION, // Piece soulevee, piece a promouvoir
+  COUCHE_ERREUR,    // Case en erreur
+  COUCHE_FIN,       // Fin de partie et animation de demarrage. Couvre tout l'echiquier
+  NOMBRE_COUCHES    // Doit rester le dernier
+};
+
+// Retourne le bit de la DEL 'del' dans un masque de DEL. 0 si la DEL n'existe pas (case hors de l'echiquier)
+inline uint64_t bitDel(int del)
+{
+  return (del >= 0 && del < NOMBRE_DEL) ? 1ULL << del : 0;
+}
+
+// Objet. Compose les couches et les transmet au ruban de DEL
+// Ruban : Adafruit_NeoPixel ou une classe de meme interface (voir Materiel.h)
+template <class Ruban>
+class Compositeur
+{
+public:
+  explicit Compositeur(Ruban &ruban);
+
+  void allumer(CoucheDel couche, uint64_t dels, uint32_t couleur);
+  void eteindre(CoucheDel couche, uint64_t dels);
+  void vider(CoucheDel couche);
+  bool afficher();
+  bool composer();
+  void transmettre();
+  uint32_t envois() const;
+
+private:
+  // Un _ devant une variable indique que celle-ci est propre a une instance de type Compositeur
+
+  Ruban &_ruban;
+  uint32_t _couleurs[NOMBRE_COUCHES][NOMBRE_DEL]; // Couleur de chaque DEL dans chaque couche
+  uint64_t _opaques[NOMBRE_COUCHES];              // Bit 'del' actif si la couche couvre cette DEL
+  uint32_t _envoye[NOMBRE_DEL];                   // Derniere image transmise
+  bool _modifie;                                  // Une couche a change depuis le dernier afficher()
+  uint32_t _envois;                               // Nombre de transmissions du ruban
+};
+
+// Constructeur. Toutes les couches sont transparentes. La premiere image sera toujours transmise
+template <class Ruban>
+Compositeur<Ruban>::Compositeur(Ruban &ruban) : _ruban(ruban)
+{
+  memset(_couleurs, 0, sizeof(_couleurs));
+  memset(_opaques, 0, sizeof(_opaques));
+  memset(_envoye, 0xFF, sizeof(_envoye));
+  _modifie = true;
+  _envois = 0;
+}
+
+// Donne une couleur aux DEL actives dans 'dels' (bit 'del') dans une couche
+// Une couleur a 0 est noire, pas transparente (voir eteindre)
+template <class Ruban>
+void Compositeur<Ruban>::allumer(CoucheDel couche, uint64_t dels, uint32_t couleur)
+{
+  _opaques[couche] |= dels;
+  _modifie |= dels != 0;
+  while (dels)
+  {
+    _couleurs[couche][__builtin_ctzll(dels)] = couleur;
+    dels &= dels - 1;
+  }
+}
+
+// Rend transparentes les DEL actives dans 'dels' dans une couche
+template <class Ruban>
+void Compositeur<Ruban>::eteindre(CoucheDel couche, uint64_t dels)
+{
+  _modifie |= (_opaques[couche] & dels) != 0;
+  _opaques[couche] &= ~dels;
+}
+
+// Rend toute une couche transparente
+template <class Ruban>
+void Compositeur<Ruban>::vider(CoucheDel couche)
+{
+  if (_opaques[couche])
+  {
+    _opaques[couche] = 0;
+    _modifie = true;
+  }
+}
+
+// Compose l'image et la transmet si elle differe de la derniere envoyee
+// Seules les DEL changees sont ecrites dans le ruban, suivies d'un seul show(). Vrai si le ruban a ete transmis
+template <class Ruban>
+bool Compositeur<Ruban>::afficher()
+{
+  if (!composer())
+  {
+    return false;
+  }
+  transmettre();
+  return true;
+}
+
+// Premiere moitie d'afficher() : superpose les couches et ecrit les DEL changees dans le ruban, sans le transmettre
+// Vrai si une DEL a change : transmettre() doit suivre
+template <class Ruban>
+bool Compositeur<Ruban>::composer()
+{
+  bool change = false;
+
+  if (!_modifie)
+  {
+    return false;
+  }
+  _modifie = false;
+
+  for (uint8_t del = 0; del < NOMBRE_DEL; del++)
+  {
+    uint32_t couleur = 0; // Noire si aucune couche ne couvre la DEL
+
+    for (int couche = NOMBRE_COUCHES - 1; couche >= 0; couche--)
+    {
+      if (_opaques[couche] & (1ULL << del))
+      {
+        couleur = _couleurs[couche][del];
+        break;
+      }
+    }
+
+    if (couleur != _envoye[del])
+    {
+      _envoye[del] = couleur;
+      _ruban.setPixelColor(del, couleur);
+      change = true;
+    }
+  }
+
+  return change;
+}
+
+// Deuxieme moitie d'afficher() : transmet le ruban (un seul show())
+template <class Ruban>
+void Compositeur<Ruban>::transmettre()
+{
+  _ruban.show();
+  _envois++;
+}
+
+// Retourne le nombre de transmissions du ruban depuis le demarrage
+template <class Ruban>
+uint32_t Compositeur<Ruban>::envois() const
+{
+  return _envois;
+}
+
+#endif
@@ -4,6 +4,10 @@ Cree par William Walsh, 22 mars 2024
 Derniere mise a jour : 19 mai 2024
 */
 
+#ifndef Definition_h
+
+#define Definition_h
+
 // Taille du tableau
 #define TAILLE 8
 
@@ -20,6 +24,14 @@ Derniere mise a jour : 19 mai 2024
 
 #define RS_DATA 13 // broche 15
 
+// Balayage des multiplexeurs (CD74HC4067)
+// La selection d'un canal se propage en moins de 0,1 us a 3,3 V (datasheet, tPHL/tPLH).
+// La marge couvre la capacite de la ligne commune et la resistance de rappel des interrupteurs reed
+#define STABILISATION_MUX_US 5 // Temps d'attente entre le choix d'un canal et sa lecture, en microsecondes
+#define PERIODE_BALAYAGE_MS 5  // Un balayage complet des 64 cases toutes les 5 ms (200 balayages par seconde)
+#define PERIODE_BOUTONS_MS 100 // Lecture des boutons de l'ecran
+#define ECHANTILLONS_ANTIREBOND 4 // Lectures identiques avant de publier un changement : 4 x 5 ms, plus long qu'un rebond d'interrupteur reed
+
 // LED
 #define LED 25 // broche 9
 #define LEDCOUNT 64
@@ -98,3 +110,4 @@ const unsigned char epd_bitmap_logo[] PROGMEM = { // Logo graphique
   0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff
 };
 
+#endif
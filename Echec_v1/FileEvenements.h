@@ -0,0 +1,73 @@
+/*
+FileEvenements.h - File circulaire sans verrou entre la tache de lecture (coeur 0) et le jeu (coeur 1)
+Un seul producteur ajoute et un seul consommateur retire : chacun n'ecrit que son propre indice,
+et l'ordre memoire acquire/release garantit que l'element est complet avant d'etre vu par l'autre coeur.
+Aucune section critique : le producteur n'attend jamais le consommateur.
+*/
+
+#ifndef FileEvenements_h
+
+#define FileEvenements_h
+
+#include <stdint.h>
+#include <atomic>
+
+// Structure. Un changement du tableau publie par la tache de lecture
+struct EvenementTableau
+{
+  uint64_t tableau; // Nouvel etat des 64 cases. 1 indique qu'une piece est sur la case
+  uint64_t change;  // Cases qui ont change depuis l'evenement precedent
+  uint32_t temps;   // Instant de la lecture (micros)
+};
+
+// Objet. File circulaire a un producteur et un consommateur
+// CAPACITE doit etre une puissance de 2. La file garde au plus CAPACITE - 1 elements
+template <class T, uint16_t CAPACITE>
+class FileEvenements
+{
+  static_assert(CAPACITE >= 2 && (CAPACITE & (CAPACITE - 1)) == 0, "La taille de la file doit etre une puissance de 2");
+
+public:
+  bool ajouter(const T &element);
+  bool retirer(T &element);
+
+private:
+  // Un _ devant une variable indique que celle-ci est propre a une instance de type FileEvenements
+
+  T _elements[CAPACITE];
+  std::atomic<uint16_t> _tete{0};  // Prochain element a retirer. Ecrit seulement par le consommateur
+  std::atomic<uint16_t> _queue{0}; // Prochaine place libre. Ecrite seulement par le producteur
+};
+
+// Producteur. Ajoute un element a la fin de la file. Faux si la file est pleine
+template <class T, uint16_t CAPACITE>
+bool FileEvenements<T, CAPACITE>::ajouter(const T &element)
+{
+  uint16_t queue = _queue.load(std::memory_order_relaxed);
+  uint16_t suivante = (queue + 1) & (CAPACITE - 1);
+
+  if (suivante == _tete.load(std::memory_order_acquire))
+  {
+    return false;
+  }
+  _elements[queue] = element;
+  _queue.store(suivante, std::memory_order_release);
+  return true;
+}
+
+// Consommateur. Retire le premier element de la file. Faux si la file est vide
+template <class T, uint16_t CAPACITE>
+bool FileEvenements<T, CAPACITE>::retirer(T &element)
+{
+  uint16_t tete = _tete.load(std::memory_order_relaxed);
+
+  if (tete == _queue.load(std::memory_order_acquire))
+  {
+    return false;
+  }
+  element = _elements[tete];
+  _tete.store((tete + 1) & (CAPACITE - 1), std::memory_order_release);
+  return true;
+}
+
+#endif
@@ -0,0 +1,121 @@
+/*
+Histogramme.h - Histogramme de latences a classes fixes, pour les sondes des chemins critiques
+Une duree (en cycles du processeur ou en microsecondes) tombe dans une classe trouvee par son bit le plus haut
+et les deux bits suivants : 4 classes par puissance de 2, donc une erreur d'au plus 25 %, sur toute la plage
+d'un uint32_t en 124 compteurs. Enregistrer coute un __builtin_clz, deux decalages et un increment, sans verrou :
+chaque histogramme n'a qu'une tache qui enregistre. Les autres taches lisent les compteurs pour les centiles.
+*/
+
+#ifndef Histogramme_h
+
+#define Histogramme_h
+
+#include <stdint.h>
+#include <atomic>
+
+#define CLASSES_HISTOGRAMME 124 // 4 classes pour 0 a 3, puis 4 par puissance de 2 de 4 a 2^32 - 1
+
+// Objet. Compte les durees d'une etape par classes
+// enregistrer() ne doit etre appele que par une seule tache. Les lectures peuvent venir de n'importe quelle tache
+class Histogramme
+{
+public:
+  void enregistrer(uint32_t duree);
+  uint32_t nombre() const;
+  uint32_t centile(uint8_t pourcent) const;
+  uint32_t maximum() const;
+
+private:
+  // Un _ devant une variable indique que celle-ci est propre a une instance de type Histogramme
+
+  std::atomic<uint32_t> _classes[CLASSES_HISTOGRAMME] = {}; // Nombre de durees de chaque classe
+  std::atomic<uint32_t> _nombre{0};                         // Nombre de durees enregistrees
+  std::atomic<uint32_t> _maximum{0};                        // Plus longue duree, exacte
+
+  static uint8_t classe(uint32_t duree);
+  static uint32_t borne(uint8_t classe);
+};
+
+// Ajoute une duree. Une seule tache ecrit : chaque compteur est lu puis ecrit, sans instruction atomique
+inline void Histogramme::enregistrer(uint32_t duree)
+{
+  std::atomic<uint32_t> &compte = _classes[classe(duree)];
+
+  compte.store(compte.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  _nombre.store(_nombre.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  if (duree > _maximum.load(std::memory_order_relaxed))
+  {
+    _maximum.store(duree, std::memory_order_relaxed);
+  }
+}
+
+// Retourne le nombre de durees enregistrees
+inline uint32_t Histogramme::nombre() const
+{
+  return _nombre.load(std::memory_order_relaxed);
+}
+
+// Retourne une borne superieure du centile 'pourcent' : la plus grande duree de sa classe, sans depasser le maximum
+// 0 si rien n'a ete enregistre
+inline uint32_t Histogramme::centile(uint8_t pourcent) const
+{
+  uint32_t comptes[CLASSES_HISTOGRAMME];
+  uint64_t total = 0;
+  uint64_t cumul = 0;
+
+  // Copie d'abord : les compteurs peuvent avancer pendant la lecture
+  for (uint8_t i = 0; i < CLASSES_HISTOGRAMME; i++)
+  {
+    comptes[i] = _classes[i].load(std::memory_order_relaxed);
+    total += comptes[i];
+  }
+  if (total == 0)
+  {
+    return 0;
+  }
+
+  uint64_t rang = (total * pourcent + 99) / 100; // Nombre de durees sous le centile, arrondi vers le haut
+  for (uint8_t i = 0; i < CLASSES_HISTOGRAMME; i++)
+  {
+    cumul += comptes[i];
+    if (cumul >= rang)
+    {
+      uint32_t maximum = this->maximum();
+      return (borne(i) < maximum) ? borne(i) : maximum;
+    }
+  }
+  return maximum();
+}
+
+// Retourne la plus longue duree enregistree
+inline uint32_t Histogramme::maximum() const
+{
+  return _maximum.load(std::memory_order_relaxed);
+}
+
+// Retourne la classe d'une duree : la duree elle-meme sous 4, sinon 4 classes par puissance de 2
+inline uint8_t Histogramme::classe(uint32_t duree)
+{
+  if (duree < 4)
+  {
+    return duree;
+  }
+  uint8_t haut = 31 - __builtin_clz(duree); // Bit le plus haut, 2 a 31
+
+  return haut * 4 - 4 + ((duree >> (haut - 2)) & 3);
+}
+
+// Retourne la plus grande duree d'une classe
+inline uint32_t Histogramme::borne(uint8_t classe)
+{
+  if (classe < 4)
+  {
+    return classe;
+  }
+  uint8_t haut = (classe + 4) / 4;
+  uint32_t largeur = 1UL << (haut - 2); // Durees par classe a cette puissance de 2
+
+  return (uint32_t)(((uint64_t)(4 + classe % 4) << (haut - 2)) + largeur - 1);
+}
+
+#endif
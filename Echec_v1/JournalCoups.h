@@ -0,0 +1,220 @@
+/*
+JournalCoups.h - Journal des coups de la partie, garde en flash par lots
+Chaque coup joue est range tel quel (un Coup de 16 bits : depart, arrivee, promotion et drapeaux)
+dans un anneau en memoire vive. Les coups sont ajoutes au fichier par lots de LOT_JOURNAL coups
+(une page de flash de 256 octets), et une derniere fois a la fin de la partie : la flash est ecrite rarement,
+toujours par ajout. La partie terminee reste dans le fichier jusqu'au debut de la suivante, meme apres un redemarrage.
+exporterPgn() rejoue le journal coup par coup sur un seul Board et ecrit la partie en PGN sur le port serie,
+sans jamais charger toute la partie en memoire. Une partie reprise (sauvegarde ou FEN) commence a sa position,
+gardee en FEN dans un second fichier.
+*/
+
+#ifndef JournalCoups_h
+
+#define JournalCoups_h
+
+#include <stdint.h>
+#include <string.h>
+#include <Board.h>
+#include <Fen.h>
+#include <Pgn.h>
+
+#define TAILLE_JOURNAL 256         // Coups gardes en memoire vive. Puissance de 2
+#define LOT_JOURNAL 128            // Coups ajoutes au fichier d'un seul coup : 256 octets, une page de flash
+#define LECTURE_JOURNAL 32         // Coups lus du fichier a la fois pendant l'exportation
+#define FICHIER_JOURNAL "/partie.bin" // Coups de la partie courante, ou de la derniere partie
+#define FICHIER_DEPART "/depart.fen"  // Position de depart de la partie du journal
+
+// Objet. Journal des coups d'une partie
+// Toutes les fonctions doivent etre appelees par la meme tache : celle du jeu
+template <class Materiel>
+class JournalCoups
+{
+  static_assert((TAILLE_JOURNAL & (TAILLE_JOURNAL - 1)) == 0, "La taille du journal doit etre une puissance de 2");
+  static_assert(LOT_JOURNAL <= TAILLE_JOURNAL, "Un lot doit tenir dans le journal");
+
+public:
+  void demarrer();
+  void commencer(const Board &depart);
+  void ajouter(Coup coup);
+  void terminer(short gagnant);
+  void exporterPgn() const;
+  uint16_t nombre() const;
+
+private:
+  using Console = typename Materiel::Console;
+  using Fichiers = typename Materiel::Fichiers;
+
+  // Un _ devant une variable indique que celle-ci est propre a une instance de type JournalCoups
+
+  Coup _anneau[TAILLE_JOURNAL]; // Derniers coups. Le coup 'i' de la partie est a la place i % TAILLE_JOURNAL
+  uint16_t _ecrits = 0;         // Nombre de coups de la partie
+  uint16_t _persistes = 0;      // Nombre de coups deja dans le fichier
+  short _gagnant = 0;           // 1 : blancs, -1 : noirs, 0 : partie en cours ou resultat inconnu
+  bool _arrete = false;         // Un coup a ete perdu : plus aucun coup n'est garde jusqu'a la prochaine partie
+
+  bool persister(uint16_t nombre);
+  Coup lire(uint16_t index, Coup (&lot)[LECTURE_JOURNAL], uint16_t &debutLot) const;
+};
+
+// Reprend le journal du fichier : la derniere partie peut etre exportee apres un redemarrage
+template <class Materiel>
+void JournalCoups<Materiel>::demarrer()
+{
+  _ecrits = _persistes = Fichiers::taille(FICHIER_JOURNAL) / sizeof(Coup);
+  _gagnant = 0;
+  _arrete = false;
+}
+
+// Debut d'une nouvelle partie a la position 'depart'. Le journal de la partie precedente est efface
+template <class Materiel>
+void JournalCoups<Materiel>::commencer(const Board &depart)
+{
+  char fen[TAILLE_FEN];
+  int longueur = ecrireFen(depart, fen, sizeof(fen));
+
+  Fichiers::effacer(FICHIER_JOURNAL);
+  Fichiers::effacer(FICHIER_DEPART);
+  Fichiers::ajouter(FICHIER_DEPART, fen, longueur);
+  _ecrits = _persistes = 0;
+  _gagnant = 0;
+  _arrete = false;
+}
+
+// Ajoute un coup joue. Un lot complet est ajoute au fichier
+// Si le fichier refuse les ecritures depuis un tour complet de l'anneau, le coup n'est pas garde :
+// le journal s'arrete jusqu'a la prochaine partie, et les coups deja gardes restent une partie valide.
+// Garder les coups suivants laisserait un trou : exporterPgn() rejouerait des coups illegaux
+template <class Materiel>
+void JournalCoups<Materiel>::ajouter(Coup coup)
+{
+  if (_arrete)
+  {
+    return;
+  }
+  if ((uint16_t)(_ecrits - _persistes) == TAILLE_JOURNAL && !persister(LOT_JOURNAL))
+  {
+    _arrete = true;
+    return;
+  }
+  _anneau[_ecrits % TAILLE_JOURNAL] = coup;
+  _ecrits++;
+
+  if ((uint16_t)(_ecrits - _persistes) >= LOT_JOURNAL)
+  {
+    persister(LOT_JOURNAL);
+  }
+}
+
+// Fin de la partie. Les coups pas encore dans le fichier y sont ajoutes
+// gagnant : 1 pour les blancs, -1 pour les noirs, 0 si la partie a ete interrompue
+template <class Materiel>
+void JournalCoups<Materiel>::terminer(short gagnant)
+{
+  _gagnant = gagnant;
+  persister(_ecrits - _persistes);
+}
+
+// Ecrit la partie en PGN sur le port serie, a partir de sa position de depart
+// Les coups deja dans le fichier y sont relus par petits lots, les autres viennent de l'anneau
+template <class Materiel>
+void JournalCoups<Materiel>::exporterPgn() const
+{
+  const char *resultat = (_gagnant > 0) ? "1-0" : (_gagnant < 0) ? "0-1" : "*";
+  Board plateau;
+  Coup lot[LECTURE_JOURNAL];
+  uint16_t debutLot = UINT16_MAX; // Index du premier coup de 'lot'. Aucun lot lu
+  char san[TAILLE_SAN];
+  char fen[TAILLE_FEN] = {};
+  uint16_t demiCoup;              // Demi-coups depuis le premier coup des blancs
+
+  if (!Fichiers::lire(FICHIER_DEPART, 0, fen, sizeof(fen) - 1) || !lireFen(plateau, fen))
+  {
+    strcpy(fen, FEN_DEPART);
+    lireFen(plateau, fen);
+  }
+  demiCoup = (plateau.getTrait() < 0) ? 1 : 0;
+
+  Console::ecrireLigne("[Event \"Echec\"]");
+  Console::ecrireLigne("[Site \"Echiquier magnetique\"]");
+  Console::ecrireLigne("[White \"Blancs\"]");
+  Console::ecrireLigne("[Black \"Noirs\"]");
+  Console::ecrire("[Result \"");
+  Console::ecrire(resultat);
+  Console::ecrireLigne("\"]");
+  if (strcmp(fen, FEN_DEPART))
+  {
+    Console::ecrireLigne("[SetUp \"1\"]");
+    Console::ecrire("[FEN \"");
+    Console::ecrire(fen);
+    Console::ecrireLigne("\"]");
+  }
+  Console::ecrireLigne();
+
+  for (uint16_t i = 0; i < _ecrits; i++, demiCoup++)
+  {
+    Coup coup = lire(i, lot, debutLot);
+
+    if (coup == COUP_NUL)
+    {
+      break; // Coup perdu : la suite ne peut plus etre rejouee
+    }
+    if (demiCoup % 2 == 0 || i == 0)
+    {
+      Console::ecrire(demiCoup / 2 + 1);
+      Console::ecrire(demiCoup % 2 ? "... " : ". ");
+    }
+    ecrireSan(plateau, coup, san, sizeof(san));
+    Console::ecrire(san);
+    Console::ecrire(' ');
+    plateau.jouer(coup);
+  }
+  Console::ecrireLigne(resultat);
+}
+
+// Retourne le nombre de coups de la partie
+template <class Materiel>
+uint16_t JournalCoups<Materiel>::nombre() const
+{
+  return _ecrits;
+}
+
+// Ajoute les 'nombre' plus vieux coups pas encore persistes au fichier. Faux si l'ecriture a echoue
+// Un lot qui fait le tour de l'anneau est ecrit en deux morceaux
+template <class Materiel>
+bool JournalCoups<Materiel>::persister(uint16_t nombre)
+{
+  while (nombre)
+  {
+    uint16_t debut = _persistes % TAILLE_JOURNAL;
+    uint16_t morceau = (debut + nombre > TAILLE_JOURNAL) ? TAILLE_JOURNAL - debut : nombre;
+
+    if (!Fichiers::ajouter(FICHIER_JOURNAL, _anneau + debut, morceau * sizeof(Coup)))
+    {
+      return false;
+    }
+    _persistes += morceau;
+    nombre -= morceau;
+  }
+  return true;
+}
+
+// Retourne le coup 'index' de la partie. COUP_NUL si le fichier ne peut pas etre lu
+// Les coups du fichier sont lus LECTURE_JOURNAL a la fois dans 'lot'
+template <class Materiel>
+Coup JournalCoups<Materiel>::lire(uint16_t index, Coup (&lot)[LECTURE_JOURNAL], uint16_t &debutLot) const
+{
+  if (index >= _persistes)
+  {
+    return _anneau[index % TAILLE_JOURNAL];
+  }
+  if (debutLot == UINT16_MAX || index < debutLot || index >= debutLot + LECTURE_JOURNAL)
+  {
+    memset(lot, 0, sizeof(lot)); // Les coups qui manquent au fichier sont lus comme COUP_NUL
+    Fichiers::lire(FICHIER_JOURNAL, (size_t)index * sizeof(Coup), lot, sizeof(lot));
+    debutLot = index;
+  }
+  return lot[index - debutLot];
+}
+
+#endif
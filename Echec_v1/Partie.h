@@ -0,0 +1,1810 @@
+/*
+  Jeu d'echec
+
+  Jeu d'echec utilisant des senseurs dans les cases pour detecter la presence d'une piece sur sa surface
+  Ces senseurs sont relier a des multiplexeurs pour gerer leur lecture
+  Des DEL sous la surface de jeu permettent d'indiquer la couleur des cases ainsi que des actions
+  ou des erreurs par les joueurs
+  Un ecran et deux boutons permettent de controler quelle piece deviendra un pion apres une promotion
+
+  Le jeu ne parle jamais directement au materiel : il recoit une politique 'Materiel' (voir Materiel.h)
+  Echec_v1.ino l'instancie pour l'ESP32 et Simulation/simulation.cpp pour un ordinateur Linux
+
+  Cree par William Walsh, 5 mars 2024
+  Derniere mise a jour : 17 mai 2024
+*/
+
+#ifndef Partie_h
+
+#define Partie_h
+
+#include <Materiel.h>
+#include "Definition.h"
+#include "Balayeur.h"
+#include "Antirebond.h"
+#include "FileEvenements.h"
+#include "VerrouSequence.h"
+#include "TacheDel.h"
+#include "TacheEcran.h"
+#include "JournalCoups.h"
+#include "Sauvegarde.h"
+#include "Traces.h"
+#include "Histogramme.h"
+#include "TacheMoteur.h"
+#include <string.h>
+#include <stdio.h>
+// Sur mesure
+#include <Case.h>
+#include <Livre.h>
+#include <Finales.h>
+
+// Representation hexadecimale des 16 premieres et 16 dernieres cases
+// d'un tableau d'echec activees
+#define GAMESTART 0xFFFF00000000FFFF
+
+#define TESTREEL true       // Active le mode reel sur un 'true' ou le mode test sur un 'false'
+#define DEBUG false         // Active les commentaire de debugage
+#define PERIODE_RAPPORT_MS 10000 // Affichage du nombre de balayages par seconde
+#define TAILLE_FILE_TABLEAU 64   // Changements du tableau en attente du jeu. Puissance de 2
+#define TAILLE_COMMANDE 96       // Longueur maximale d'une commande du port serie, incluant le '\0'
+#define MOTEUR_BLANCS 1          // Le Moteur joue les blancs. Voir la commande "moteur"
+#define MOTEUR_NOIRS 2           // Le Moteur joue les noirs
+
+// Objet. Une partie d'echecs sur l'echiquier magnetique
+// Materiel : politique materielle (MaterielEsp32 ou MaterielHote). Voir Materiel.h
+template <class Materiel>
+class Partie
+{
+public:
+  Partie();
+
+  void setup();
+  void loop();
+
+  const Board &getPlateau() const;
+  uint32_t balayagesParSeconde() const;
+  uint64_t getTableauCourant() const;
+  uint32_t reprisesTableau() const;
+  uint32_t envoisDel() const;
+  uint32_t pagesEcran() const;
+  Coup coupPropose() const;
+  uint32_t noeudsParSeconde() const;
+  void lireCommandes();
+
+private:
+  using Horloge = typename Materiel::Horloge;
+  using Gpio = typename Materiel::Gpio;
+  using Console = typename Materiel::Console;
+  using Taches = typename Materiel::Taches;
+  using Ruban = typename Materiel::Ruban;
+
+  // Un _ devant une variable indique que celle-ci est propre a une instance de type Partie
+
+  TacheEcran<Materiel> _ecran;        // Ecran OLED, dessine et transmis par sa propre tache
+  TacheDel<Materiel> _del;            // DEL adressables sous les cases, dessinees et transmises par leur propre tache
+  Balayeur<Materiel> _balayeur;       // Lecture des 64 interrupteurs reed a travers les multiplexeurs
+  Move _actionPossible[64];           // Liste des deplacements possibles que peut prendre une piece. Chaque position est un deplacement unique
+  ListeCoups _coupsTour;              // Coups legaux du joueur actif, generes au debut du tour et ranges par case de depart
+  Board _plateau;                     // Position des pieces sous forme de bitboards. Source de verite de la partie
+  Case _echiquier[TAILLE][TAILLE];    // Matrice des cases du jeu d'echec. Chaque case est une vue sur '_plateau'
+  uint64_t _tableau = 0;              // Etat du tableau vu par le jeu : celui du dernier evenement retire de la file
+  uint32_t _tempsTableau = 0;         // Instant (micros) de la lecture de '_tableau'
+  uint64_t _touches = 0;              // Cases qui ont change depuis le debut du tour
+  uint64_t _publie = 0;               // Dernier etat ajoute a la file. Propre a la tache de lecture
+  uint32_t _filePleine = 0;           // Nombre de publications retardees par une file pleine
+  FileEvenements<EvenementTableau, TAILLE_FILE_TABLEAU> _evenements; // Changements du tableau, de la tache de lecture vers le jeu
+  typename Taches::Signal _signal;    // Reveille le jeu quand un evenement est ajoute
+  VerrouSequence<uint64_t> _instantane; // Dernier etat stable du tableau, lisible sans verrou par toutes les taches
+  JournalCoups<Materiel> _journal;    // Coups de la partie, gardes en flash par lots
+  Sauvegarde<Materiel> _sauvegarde;   // Position de la partie en cours, gardee en NVS apres chaque coup
+  bool _reprise = false;              // '_plateau' est une position a reprendre (sauvegarde ou FEN) et non le depart
+  bool _enPartie = false;             // Une partie est en cours : la position ne peut plus etre remplacee
+  Traces<Materiel> _traces;           // Traces de diagnostic, ecrites sur le port serie par leur propre tache
+  Histogramme _latenceBalayage;       // Cycles d'un balayage des 64 cases. Tache de lecture
+  Histogramme _latencePublication;    // Cycles pour publier un etat du tableau. Tache de lecture
+  Histogramme _latenceDifference;     // Cycles de difference(). Jeu
+  Histogramme _latenceGeneration;     // Cycles pour generer les coups legaux du tour. Jeu
+  Histogramme _latenceCoups;          // Cycles de bougerPiece(). Jeu
+  Histogramme _latenceEchec;          // Cycles pour savoir si un roi est en echec. Jeu
+  TacheMoteur<Materiel> _moteur;      // Adversaire. Cherche le coup d'un joueur dans sa propre tache
+  uint8_t _campsMoteur = 0;           // Joueurs que le Moteur joue : MOTEUR_BLANCS, MOTEUR_NOIRS ou les deux
+  uint32_t _budgetMoteur = BUDGET_MOTEUR_MS; // Millisecondes de recherche par coup. 0 : sans limite de temps
+  uint8_t _profondeurMoteur = 0;      // Profondeur maximale de la recherche. 0 : sans limite
+  uint64_t _historique[HISTORIQUE_MAX]; // Cles des dernieres positions de la partie, la plus recente a la fin
+  uint8_t _positionsHistorique = 0;   // Positions dans '_historique'
+  std::atomic<Coup> _coupPropose{COUP_NUL}; // Coup que le Moteur demande de jouer sur l'echiquier. COUP_NUL si aucun
+  uint64_t _clePropose = 0;           // Cle Zobrist de la position de '_coupPropose'
+  std::atomic<uint32_t> _noeudsParSeconde{0}; // Vitesse de la derniere recherche
+  int8_t _finaleAnnoncee = -1;        // Finale et gagnant deja annonces (voir annoncerFinale). -1 hors des tables
+  char _commande[TAILLE_COMMANDE];    // Commande du port serie en cours de reception
+  uint8_t _longueurCommande = 0;      // Caracteres recus de la commande en cours
+  bool _utiliseTest = false;          // Demarre la partie demo de jeuVirtuel()
+
+  static constexpr char PROMOTION[] = {'R', 'N', 'B', 'Q'}; // Liste des pieces disponibles possibles lors de la promotion d'un pion
+
+  static void tacheLecture(void *partie);
+  void LectureTableau();
+  void jeuVirtuel();
+
+  void initialiseGrille(Board &plateau, Case (&echiquier)[8][8]);
+  void setupPartie(uint64_t tableauCourant);
+  void placerPieces();
+  Case difference(uint64_t vieuxTableau, uint64_t tableauCourant, const Case echiquier[8][8]);
+  void clearAction();
+  void deplaceTourRoque(const Case &dep, const Case &arriv, const Case echiquier[8][8]);
+  void echangePromotion(const Case &piece, const Case echiquier[8][8]);
+  uint64_t getTableau();
+  bool attendreTableau(uint32_t ms = PERIODE_BOUTONS_MS);
+  bool publierTableau(uint64_t valeur);
+  void executerCommande(const char *commande);
+  void afficheLatences();
+  void afficheLatence(const char *nom, const Histogramme &histogramme, uint32_t parMicro);
+  void importerFen(const char *fen);
+  void choisirMoteur(const char *parametres);
+  bool moteurJoue(short joueur) const;
+  Coup proposerCoup();
+  void afficheLivre();
+  void annoncerFinale();
+  void noterPosition();
+  uint64_t virtuelleToBits(const Board &plateau);
+
+  void InitialiseLED();
+  void ledEchiquier();
+  void ledPlacement(uint64_t manquantes, uint64_t enTrop);
+  uint64_t delsCases(uint64_t cases);
+  void ledAction(int positions);
+  void ledErreur(const Case &erreur, uint64_t tableauPrecedent);
+  void ledEchec(int joueur);
+  void ledFin(int gagnant);
+  void ledProposition(Coup coup);
+
+  void afficheTableauPiece(Case (&echiquier)[8][8]);
+  void afficheTableauPresence();
+  void afficheMultiplexeur();
+  void afficheTableauJoueur();
+  void afficheTableauNom();
+  void afficheTableauDetail();
+  void afficheStabilisation();
+  void print64BIN(uint64_t valeur);
+};
+
+// Constructeur. Le ruban et l'ecran sont crees, mais pas encore demarres. Voir setup()
+template <class Materiel>
+Partie<Materiel>::Partie() : _del(LEDCOUNT, LED)
+{
+}
+
+// Retourne la position des pieces
+template <class Materiel>
+const Board &Partie<Materiel>::getPlateau() const
+{
+  return _plateau;
+}
+
+// Retourne le nombre de balayages du tableau lors de la derniere seconde
+template <class Materiel>
+uint32_t Partie<Materiel>::balayagesParSeconde() const
+{
+  return _balayeur.balayagesParSeconde();
+}
+
+// Retourne le dernier etat stable du tableau lu par la tache de lecture, sans attendre le jeu
+// Peut etre appele de n'importe quelle tache
+template <class Materiel>
+uint64_t Partie<Materiel>::getTableauCourant() const
+{
+  return _instantane.lire();
+}
+
+// Retourne le nombre de lectures de getTableauCourant() qui ont du recommencer pendant une publication
+template <class Materiel>
+uint32_t Partie<Materiel>::reprisesTableau() const
+{
+  return _instantane.reprises();
+}
+
+// Retourne le nombre d'images transmises au ruban de DEL depuis le demarrage
+template <class Materiel>
+uint32_t Partie<Materiel>::envoisDel() const
+{
+  return _del.envois();
+}
+
+// Retourne le nombre de pages (8 rangees de pixels) transmises a l'ecran OLED depuis le demarrage
+template <class Materiel>
+uint32_t Partie<Materiel>::pagesEcran() const
+{
+  return _ecran.pagesTransmises();
+}
+
+// Retourne le coup que le Moteur demande de jouer sur l'echiquier, ou COUP_NUL
+// Peut etre appele de n'importe quelle tache
+template <class Materiel>
+Coup Partie<Materiel>::coupPropose() const
+{
+  return _coupPropose.load(std::memory_order_acquire);
+}
+
+// Retourne le nombre de noeuds par seconde de la derniere recherche du Moteur
+template <class Materiel>
+uint32_t Partie<Materiel>::noeudsParSeconde() const
+{
+  return _noeudsParSeconde.load(std::memory_order_relaxed);
+}
+
+// Point d'entree de la tache de lecture. 'partie' est l'instance qui a cree la tache
+template <class Materiel>
+void Partie<Materiel>::tacheLecture(void *partie)
+{
+#if TESTREEL
+  static_cast<Partie *>(partie)->LectureTableau();
+#else
+  static_cast<Partie *>(partie)->jeuVirtuel();
+#endif
+}
+
+// Balaye les 64 cases du tableau de jeu a un rythme fixe (voir Balayeur.h) et publie chaque changement stable (voir Antirebond.h)
+// Le rythme atteint est trace toutes les PERIODE_RAPPORT_MS. Les boutons de l'ecran sont lus par sa tache (voir TacheEcran.h)
+template <class Materiel>
+void Partie<Materiel>::LectureTableau()
+{
+  uint64_t lecture;                        // Store la derniere lecture du tableau sous la forme de 64 bits
+  uint32_t rapport = Horloge::millis();    // Dernier affichage du rythme de balayage
+  Antirebond<ECHANTILLONS_ANTIREBOND> antirebond(_balayeur.balayer()); // La premiere lecture est l'etat stable de depart
+
+  while (Taches::actif())
+  {
+#if 0
+     Console::ecrireLigne("Lecture commence");
+#endif
+
+    uint32_t debut = Horloge::cycles();
+    uint64_t balayage = _balayeur.balayer();
+    _latenceBalayage.enregistrer(Horloge::cycles() - debut);
+
+    lecture = antirebond.filtrer(balayage);
+
+    // Si l'etat du jeu change, on le publie. Une file pleine le sera au prochain balayage
+    if (lecture != _publie && publierTableau(lecture))
+    {
+      TRACE_DETAIL(_traces, SOURCE_LECTURE, TRACE_TABLEAU, lecture);
+    }
+
+    if (Horloge::millis() - rapport >= PERIODE_RAPPORT_MS)
+    {
+      rapport = Horloge::millis();
+      TRACE_INFO(_traces, SOURCE_LECTURE, TRACE_RYTHME, _balayeur.balayagesParSeconde(), _filePleine);
+    }
+
+    // Laisse le coeur aux autres taches jusqu'au prochain balayage
+    _balayeur.attendreProchain();
+  }
+}
+
+// Simule une serie d'action prise par des joueurs
+template <class Materiel>
+void Partie<Materiel>::jeuVirtuel()
+{
+  int delaie = 1500; // Temps entre les action
+  Board plateauTest; // Position des pieces de l'echiquier de test
+  Case test[8][8];   // Creer un echiquier pour effectuer des tests
+  uint64_t virtuel;  // Representation du tableau sur 64 bits
+  Move list[64];     // Cree une list d'action possible
+  int i = 0;         // Index representant le nombre d'elements actifs dans 'list'
+
+  // Liste de deplacement. De (x1, y1) a (x2, y2)
+  list[0] = {1, 1, 2, 1};
+  list[1] = {6, 7, 5, 7};
+  list[2] = {2, 1, 3, 1};
+  list[3] = {5, 7, 4, 7};
+  list[4] = {3, 1, 4, 1};
+  list[5] = {4, 7, 3, 7};
+  list[6] = {4, 1, 5, 1};
+  list[7] = {3, 7, 2, 7};
+  list[8] = {5, 1, 6, 2};
+  list[9] = {2, 7, 1, 6};
+  list[10] = {6, 2, 7, 3};
+  list[11] = {1, 6, 0, 5};
+
+  // Initialisation du jeu
+  initialiseGrille(plateauTest, test);
+  virtuel = virtuelleToBits(plateauTest);
+  publierTableau(GAMESTART);
+
+  Horloge::attendre(delaie);
+
+  while (Taches::actif()) // Boucle pour rouler la partie demo
+  {
+    if (_utiliseTest && i < 12)
+    {
+      Move a = list[i]; // Action qui sera faite pendant le tour
+
+      char piece = test[a.fromRow][a.fromCol].getPiece();    // pour substitution
+      short joueur = test[a.fromRow][a.fromCol].getJoueur(); // pour substitution
+
+      // La piece est soulevee du jeu
+      Console::ecrire("leve ");
+      test[a.fromRow][a.fromCol].setJoueur(0);
+      test[a.fromRow][a.fromCol].setPiece(' ');
+
+      // On met a jour l'etat du jeu sur 64 bits
+      virtuel = virtuelleToBits(plateauTest);
+      publierTableau(virtuel);
+
+      Console::ecrire("Automove Move ");
+      print64BIN(virtuel);
+
+      Horloge::attendre(delaie);
+
+      // On verifie s'il y a une capture
+      if (test[a.toRow][a.toCol].getJoueur() == -1 * joueur)
+      {
+        // On retire la piece adverse du tableau
+        Console::ecrire("eat! ");
+        test[a.toRow][a.toCol].setJoueur(0);
+        test[a.toRow][a.toCol].setPiece(' ');
+
+        // Mise a jour
+        virtuel = virtuelleToBits(plateauTest);
+        publierTableau(virtuel);
+
+        Horloge::attendre(delaie);
+      }
+
+      // La piece est redepose sur le jeu
+      Console::ecrire("Drop ");
+      test[a.toRow][a.toCol].setPiece(piece);
+      test[a.toRow][a.toCol].setJoueur(joueur);
+
+      // Mise a jour
+      virtuel = virtuelleToBits(plateauTest);
+      publierTableau(virtuel);
+
+      // Incrementation pour passer au prochain tour
+      i++;
+
+      Horloge::attendre(delaie);
+    }
+    Horloge::attendre(delaie);
+  }
+}
+
+template <class Materiel>
+void Partie<Materiel>::setup()
+{
+  // Le baud rate pour le ESP32 est 115200
+  Console::demarrer(115200);
+  Console::ecrireLigne("Connexion serielle etablie");
+
+  // Priorite 0 sur le coeur 0 : les traces ne sont ecrites que quand la tache de lecture dort entre deux balayages
+  _traces.demarrer(0, 0);
+
+  // Pour verifier sur quel coeur roule le setup
+  Console::ecrire("setup() in core ");
+  Console::ecrireLigne(Taches::coeur());
+
+  Gpio::configurer(MUX_S0, OUTPUT);
+  Gpio::ecrire(MUX_S0, LOW);
+  Gpio::configurer(MUX_S1, OUTPUT);
+  Gpio::ecrire(MUX_S1, LOW);
+  Gpio::configurer(MUX_S2, OUTPUT);
+  Gpio::ecrire(MUX_S2, LOW);
+  Gpio::configurer(MUX_S3, OUTPUT);
+  Gpio::ecrire(MUX_S3, LOW);
+
+  Gpio::configurer(MUX1_E, OUTPUT);
+  Gpio::ecrire(MUX1_E, HIGH);
+  Gpio::configurer(MUX2_E, OUTPUT);
+  Gpio::ecrire(MUX2_E, HIGH);
+  Gpio::configurer(MUX3_E, OUTPUT);
+  Gpio::ecrire(MUX3_E, HIGH);
+  Gpio::configurer(MUX4_E, OUTPUT);
+  Gpio::ecrire(MUX4_E, HIGH);
+
+  Gpio::configurer(RS_DATA, INPUT);
+  Gpio::ecrire(RS_DATA, LOW);
+  Console::ecrireLigne("Pin allouee");
+
+  Gpio::configurer(CONFIRME, INPUT);
+  Gpio::ecrire(CONFIRME, LOW);
+  Gpio::configurer(CHANGER, INPUT);
+  Gpio::ecrire(CHANGER, LOW);
+  Console::ecrireLigne("Boutons actifs");
+
+  // Temps de stabilisation de chaque entree des multiplexeurs. Garder les deux boutons enfonces au demarrage pour recalibrer
+  if ((Gpio::lire(CONFIRME) && Gpio::lire(CHANGER)) || !_balayeur.charger())
+  {
+    Console::ecrireLigne("Calibration des multiplexeurs");
+    if (!_balayeur.calibrer())
+    {
+      Console::ecrireLigne("Calibration impossible : placer les pieces sur l'echiquier");
+    }
+  }
+  afficheStabilisation();
+
+  // Luminosite 200 sur 255. Priorite 0 sur le coeur 1, sous loop() (priorite 1) : la tache ne roule que quand le jeu attend
+  _del.demarrer(200, 0, 1);
+  Console::ecrireLigne("Strip active");
+
+  initialiseGrille(_plateau, _echiquier);
+  Console::ecrireLigne("Grille virtuelle initialisee");
+
+  // Une partie interrompue par une coupure de courant reprend a sa derniere position
+  uint32_t debutReprise = Horloge::micros();
+  if (_sauvegarde.charger(_plateau))
+  {
+    char fen[TAILLE_FEN];
+
+    _reprise = true;
+    Console::ecrire("Partie reprise en ");
+    Console::ecrire(Horloge::micros() - debutReprise);
+    Console::ecrireLigne(" us");
+    ecrireFen(_plateau, fen, sizeof(fen));
+    Console::ecrireLigne(fen);
+  }
+
+  _ecran.demarrer(1, 1); // Priorite 1 sur le coeur 1, comme loop()
+  Console::ecrireLigne("OLED initialisee");
+
+  Taches::creer(
+      tacheLecture,
+      "task0",
+      10000,
+      this,
+      1,
+      0);
+  Horloge::attendre(10);
+  Console::ecrireLigne("Tache creee");
+
+  // Sur le coeur de la lecture, sous sa priorite : la recherche prend le temps libre entre deux balayages
+  _moteur.demarrer(0, 0);
+
+  _journal.demarrer();
+
+#if 1
+  InitialiseLED();
+#else
+  ledEchiquier();
+#endif
+}
+
+template <class Materiel>
+void Partie<Materiel>::loop()
+{
+  bool enJeu = true;                                     // indique si une partie est en cours
+  bool actionValide = false;                             // indique si l'action est valide et si l'on peut passer a la prochaine etape
+  bool promo = false;                                    // indique si un pion est pret pour une promotion
+  char piece = ' ';                                      // nom de la piece (R, N, B, Q, K, P)
+  short joueur = 1;                                      // joueur actif. Le trait de la position placee au debut de la partie
+  short rangee = -1, colonne = -1;                       // actuelle
+  short vieilleRangee = -1, vieilleColonne = -1;         // position de ou la piece a ete leve
+  short rangeeDestination = -1, colonneDestination = -1; // position de ou la piece a ete deposer
+  int positions = -1;                                    // nombre de mouvement/action/deplacement possible
+  int promouvoir = 0;                                    // promotion actuellement afficher au joueur
+  uint64_t tableauInterim = 0;                           // etat du tableau quand la piece est en l'air en binaire
+  uint64_t tableauDebutTour = 0;                         // etat du tableau au debut du tour en binaire
+  uint64_t tableauCapture = 0;                           // etat du tableau au debut de la capture en binaire
+  Case changement = Case();                              // la case de l'echiquier qui a ete modifier lors de la lecture du tableau
+  Case capture = Case();                                 // La case de l'echiquier sur laquelle se deroule une capture
+  Coup coup = COUP_NUL;                                  // dernier coup joue sur le plateau
+  short gagnant = 0;                                     // joueur qui a pris le roi adverse. 0 si la partie est interrompue
+  Coup coupLu = COUP_NUL;                                // dernier coup retrouve a partir des changements du tableau
+  Difference changementsTour;                            // cases changees entre le debut et la fin du tour
+
+  // Pour verifier sur quel coeur roule le setup
+  Console::ecrire("loop() in core ");
+  Console::ecrireLigne(Taches::coeur());
+
+  // Chaque partie commence sur une grille neuve, meme apres une remise a zero ou la capture d'un roi,
+  // sauf une partie reprise de la sauvegarde ou importee en FEN
+  if (!_reprise)
+  {
+    initialiseGrille(_plateau, _echiquier);
+  }
+
+  _ecran.afficher(ECRAN_TITRE);
+
+  // Attend que les pieces soit placer adequatement sur l'echiquier
+  placerPieces();
+  // La serpentine du demarrage, si elle joue encore, finit sur l'echiquier
+  _del.vider(COUCHE_FIN);
+  _del.arreter(COUCHE_ALERTE);
+  _del.vider(COUCHE_ALERTE);
+  _del.vider(COUCHE_ERREUR);
+  ledEchiquier();
+
+  // La partie commence a la position placee. Une partie reprise a un nouveau journal, a partir de cette position
+  _reprise = false;
+  _enPartie = true;
+  joueur = _plateau.getTrait();
+  _journal.commencer(_plateau);
+  _sauvegarde.ecrire(_plateau);
+  _moteur.vider();
+  _clePropose = 0;
+  _finaleAnnoncee = -1;
+  _positionsHistorique = 0;
+  ledEchec(joueur);
+
+#if 1
+  _utiliseTest = true;
+  Console::ecrireLigne("Started");
+#endif
+
+  // Boucle d'un tour de jeu
+  while (enJeu)
+  {
+    // sauvegarde du tableau au debut du tour
+    tableauDebutTour = getTableau();
+    _touches = 0;
+#if DEBUG // Environ 17 lignes bloquantes sur le port serie a chaque tour
+    afficheTableauPiece(_echiquier);
+#endif
+
+    // Genere tous les coups legaux du joueur une seule fois. Soulever une piece ne fera qu'une lecture dans la table
+    uint32_t debut = Horloge::cycles();
+    _coupsTour.generer(_plateau, joueur);
+    _latenceGeneration.enregistrer(Horloge::cycles() - debut);
+    noterPosition();
+    annoncerFinale();
+
+    // Aucun coup legal : mat si le roi est en echec, sinon pat. Le roi n'est jamais pris : c'est la seule fin de partie
+    if (_coupsTour.nombre() == 0)
+    {
+      gagnant = _plateau.echecs(joueur) ? -joueur : 0;
+      Console::ecrireLigne(gagnant ? "Echec et mat" : "Pat : partie nulle");
+      if (gagnant)
+      {
+        ledFin(gagnant);
+      }
+      break;
+    }
+
+    // Le Moteur choisit le coup de son joueur. Le joueur humain le fait sur l'echiquier : c'est le seul coup permis
+    if (moteurJoue(joueur))
+    {
+      Coup propose = proposerCoup();
+
+      if (propose == COUP_NUL)
+      {
+        break;
+      }
+      _coupsTour.garder(propose);
+    }
+
+  // Les vulnerabilites a la prise en passant sont retirees par Board::jouer au coup suivant
+
+    // Premiere partie du tour : On souleve une piece valide
+    actionValide = false;
+    while (!actionValide)
+    {
+      attendreTableau();
+
+      // Verifie si une piece a ete bougee
+      if (getTableau() != tableauDebutTour)
+      {
+#if DEBUG
+        afficheTableauPiece(_echiquier);
+#endif
+
+        // On copie la case qui a ete modifiee
+        changement = difference(tableauDebutTour, getTableau(), _echiquier);
+
+        // Une piece du joueur actif a ete souleve
+        if (changement.inbounds(changement.getRangee(), changement.getColonne()) && getTableau() < tableauDebutTour && changement.getJoueur() == joueur)
+        {
+          // Sauvegarde l'etat du tableau quand une piece est soulevee
+          tableauInterim = getTableau();
+
+          piece = changement.getPiece();
+          actionValide = true;
+        }
+        // Une piece est placee sur l'echiquier ou une piece du joueur inactif est soulevee
+        else
+        {
+          ledErreur(changement, tableauDebutTour);
+        }
+      }
+    }
+
+#if DEBUG // Indique quel joueur a souleve quelle piece sur quelle case
+    Console::ecrire(changement.getCouleur());
+    Console::ecrire(" a soulever la piece ");
+    Console::ecrire(changement.getPiece());
+    Console::ecrire(" en ");
+    Console::ecrireLigne(changement.getNom());
+#endif
+
+    // Affiche les deplacements possibles
+    debut = Horloge::cycles();
+    positions = changement.bougerPiece(_coupsTour, _actionPossible);
+    _latenceCoups.enregistrer(Horloge::cycles() - debut);
+    ledAction(positions);
+
+    // Deuxieme partie du tour : la piece revient sur le jeu
+    actionValide = false;
+    while (!actionValide)
+    {
+      attendreTableau();
+
+      // Une piece a ete bouger
+      if (getTableau() != tableauInterim)
+      {
+        // On copie la case modifiee et on note ses coordonnees
+        changement = difference(tableauInterim, getTableau(), _echiquier);
+        rangee = changement.getRangee();
+        colonne = changement.getColonne();
+
+        // Une piece est ajoutee au sur l'echiquier
+        if (getTableau() > tableauInterim)
+        {
+          // On compare la case modifiee avec les deplacements possibles
+          for (int i = 0; i < positions; i++)
+          {
+            rangeeDestination = _actionPossible[i].toRow;
+            colonneDestination = _actionPossible[i].toCol;
+
+            // Si la case modifiee est parmis les cases possibles, on met a jours les cases pour refleter le changement
+            if (rangee == rangeeDestination && colonne == colonneDestination)
+            {
+              actionValide = true;
+
+              vieilleRangee = _actionPossible[i].fromRow;
+              vieilleColonne = _actionPossible[i].fromCol;
+
+              // Le Board joue le coup : prise en passant, roque, promotion et indicateurs des cases
+              // Redeposer la piece sur sa case de depart n'est pas un coup
+              coup = _coupsTour.trouver(numeroCase(vieilleRangee, vieilleColonne), numeroCase(rangee, colonne));
+              if (coup != COUP_NUL)
+              {
+                _plateau.jouer(coup);
+              }
+
+              // Le roi a ete depose. Le joueur doit maintenant deplacer la tour
+              if (estRoque(coup))
+              {
+                short tourDepart, tourArrivee;
+
+                Board::tourRoque(coup, tourDepart, tourArrivee);
+                deplaceTourRoque(_echiquier[tourDepart / TAILLE][tourDepart % TAILLE], _echiquier[tourArrivee / TAILLE][tourArrivee % TAILLE], _echiquier);
+              }
+              break;
+            }
+          }
+
+          // La piece deposee n'est pas sur une lumiere
+          if (!actionValide)
+          {
+            Console::ecrire("Depose ");
+            ledErreur(changement, tableauInterim);
+          }
+        }
+        // Une piece est retiree
+        else
+        {
+          // Capture une piece adverse
+          for (int i = 0; i < positions; i++)
+          {
+            rangeeDestination = _actionPossible[i].toRow;
+            colonneDestination = _actionPossible[i].toCol;
+
+            // Ne considere pas prise au passage
+            if (rangee == rangeeDestination && colonne == colonneDestination && changement.getJoueur() == -1 * joueur)
+            {
+              actionValide = true; // La piece retiré est sur une bonne case
+
+              vieilleRangee = _actionPossible[i].fromRow;
+              vieilleColonne = _actionPossible[i].fromCol;
+
+              coup = _coupsTour.trouver(numeroCase(vieilleRangee, vieilleColonne), numeroCase(rangee, colonne));
+              _plateau.jouer(coup);
+
+              capture = changement;
+              tableauCapture = getTableau();
+
+              break;
+            }
+            // C'est une prise au passage. Le Board confirme que le coup vers cette case en est une
+            else if (rangee == _actionPossible[i].fromRow && colonne == colonneDestination && changement.getJoueur() == -1 * joueur &&
+                     drapeauxCoup(_coupsTour.trouver(numeroCase(rangee, _actionPossible[i].fromCol), numeroCase(rangeeDestination, colonneDestination))) == COUP_EN_PASSANT)
+            {
+              actionValide = true; // La piece retiré est sur une bonne case
+
+              vieilleRangee = _actionPossible[i].fromRow;
+              vieilleColonne = _actionPossible[i].fromCol;
+
+              // Le pion du joueur arrive derriere le pion capture
+              coup = _coupsTour.trouver(numeroCase(vieilleRangee, vieilleColonne), numeroCase(rangeeDestination, colonneDestination));
+              _plateau.jouer(coup);
+
+              capture = _echiquier[rangeeDestination][colonneDestination];
+              tableauCapture = getTableau();
+
+              break;
+            }
+          }
+          // depose piece ou l'autre a ete mangee. Seule la case de la capture doit se remplir
+          while (actionValide && getTableau() != (tableauCapture | bitCase(capture.getPosition())))
+          {
+            attendreTableau();
+            if (getTableau() != tableauCapture)
+            {
+              // On verifie si la piece est deposee sur la bonne case
+              changement = difference(tableauCapture, getTableau(), _echiquier);
+              if (changement.getLed() != capture.getLed())
+              {
+                ledErreur(changement, tableauCapture);
+              }
+            }
+          }
+
+          // Piece en erreur
+          if (!actionValide)
+          {
+            Console::ecrire("Eat take "); // Message d'erreur. Rendre plus significatif
+            ledErreur(changement, tableauInterim);
+          }
+        }
+      }
+    }
+
+
+    // Verifie echec
+
+    // Promotion
+    // Observe les extremites pour des pions
+    if (piece == 'P')
+    {
+      if ((joueur == 1 && rangee == 7) || (joueur == -1 && rangee == 0))
+      {
+        promo = true;
+      }
+    }
+
+#if DEBUG
+    Console::ecrireLigne("debut promotion");
+#endif
+    if (promo == true)
+    {
+      // Indicateur de la case. La couche de selection n'est plus effacee par l'echiquier
+      _del.allumer(COUCHE_SELECTION, bitDel(_echiquier[rangee][colonne].getLed()), Ruban::Color(0, 255, 255));
+      _del.afficher();
+
+      // Choix de la promotion
+      promouvoir = 0;
+
+      Console::ecrire(_echiquier[rangee][colonne].getNom()); // Indique le pion a promouvoir
+      Console::ecrire(" a ");
+
+#if 0 // Promotion seulement a Reine pour l'instant
+      while (Gpio::lire(CONFIRME) == LOW)       // Attente de la confirmation du choix
+      {
+        if (Gpio::lire(CHANGER) == HIGH)  // Change le choix
+        {
+          promouvoir++;
+          promouvoir %= 4;
+          // TODO : Dessiner piece sur ecran
+        }
+      }
+#endif
+      (void)promouvoir;
+      // Le coup joue par le Board a deja promu le pion en reine, jusqu'a implementation graphique
+      echangePromotion(_echiquier[rangee][colonne], _echiquier);
+      Console::ecrireLigne(_echiquier[rangee][colonne].getPiece());
+
+      promo = false;
+    }
+
+#if DEBUG
+    Console::ecrireLigne("Fin promotion");
+#endif
+
+    // Vide les actions possibles
+    clearAction();
+    // Joueur redepose sa piece d'ou il l'a prise, son tour recommence
+    ledEchiquier();
+    if (getTableau() == tableauDebutTour)
+    {
+      continue;
+    }
+
+    // Le coup retrouve d'un seul coup a partir des cases changees pendant le tour doit etre celui joue
+    comparerTableaux(tableauDebutTour, getTableau(), changementsTour);
+    coupLu = _coupsTour.decoder(changementsTour, _touches);
+    if (departCoup(coupLu) != departCoup(coup) || arriveeCoup(coupLu) != arriveeCoup(coup))
+    {
+      Console::ecrireLigne("Coup lu different du coup joue");
+    }
+    _coupPropose.store(COUP_NUL, std::memory_order_release);
+    _journal.ajouter(coup);
+    _sauvegarde.ecrire(_plateau);
+
+    // Le roi adverse pulse en rouge tant qu'il est en echec
+    ledEchec(-joueur);
+
+    if (Gpio::lire(CONFIRME) && Gpio::lire(CHANGER))
+    {
+      _ecran.afficher(ECRAN_RESET);
+      enJeu = false;
+      Horloge::attendre(5000);
+    }
+
+    // prochain tour
+    joueur *= -1;
+  }
+
+  // Les derniers coups de la partie sont ajoutes au fichier du journal. Il n'y a plus de partie a reprendre
+  _journal.terminer(gagnant);
+  _sauvegarde.terminer();
+  _enPartie = false;
+}
+
+// ------------------------------------Fonctions tableau ---------------------------------------------------------
+
+// Initialisation de la partie
+// Vide le plateau, y place les pieces de depart et lie chaque case de l'echiquier au plateau
+// Le nom et l'adresse de DEL de chaque case sont dans les tables de Disposition.h
+template <class Materiel>
+void Partie<Materiel>::initialiseGrille(Board &plateau, Case (&echiquier)[8][8])
+{
+  const char rangeeArriere[] = {'R', 'N', 'B', 'K', 'Q', 'B', 'N', 'R'}; // Pieces des rangees 0 et 7, par colonne
+  int joueur; // Numero du joueur. Blanc = 1, Noir = -1
+
+  plateau.vider();
+
+  for (short i = 0; i < TAILLE; i++)
+  {
+    for (short j = 0; j < TAILLE; j++)
+    {
+      // Les rangees 0 et 1 appartiennent au joueur blanc
+      if (i <= 1)
+      {
+        joueur = 1;
+      }
+      // Les rangees 6 et 7 appartiennet au joueur noir
+      else if (i >= 6)
+      {
+        joueur = -1;
+      }
+      // Les autres rangees n'appartiennent pas a un joueur
+      else
+      {
+        joueur = 0;
+      }
+
+      // Place la piece de depart de la case. Les rangees du centre restent vides
+      if (i == 0 || i == TAILLE - 1)
+      {
+        plateau.placer(numeroCase(i, j), rangeeArriere[j], joueur);
+      }
+      else if (i == 1 || i == 6)
+      {
+        plateau.placer(numeroCase(i, j), 'P', joueur);
+      }
+
+      // Creer une vue sur la case du plateau
+      echiquier[i][j] = Case(&plateau, i, j);
+    }
+  }
+}
+
+// Attend que les pieces soient placees pour commencer une partie
+template <class Materiel>
+void Partie<Materiel>::setupPartie(uint64_t tableauCourant)
+{
+  // Affiche le jeu actuel et le tableau de depart.
+  // 1 indique qu'un pion occupe la case, 0 indique que la case n'est pas occupee
+  print64BIN(tableauCourant);
+  print64BIN(GAMESTART);
+#if 1
+  // Tant que le jeu actuel ne represente pas le jeu au depart, le jeu ne commence pas
+  while ((tableauCourant != GAMESTART))
+    ;
+#endif
+
+  Console::ecrireLigne("C'est un depart");
+}
+
+// Jeu. Attend que les pieces sur l'echiquier occupent les cases de '_plateau'
+// Les cases ou il manque une piece sont en vert, les pieces en trop en rouge. Le guide suit chaque changement du tableau
+// et chaque position importee par le port serie. L'image de fin de la partie precedente reste jusqu'au premier changement
+template <class Materiel>
+void Partie<Materiel>::placerPieces()
+{
+  uint64_t manquantes = 0, enTrop = 0; // Guide affiche
+  bool fin = true;                     // L'image de fin de la partie precedente est peut-etre encore affichee
+
+  while (getTableau() != _plateau.occupation())
+  {
+    uint64_t attendu = _plateau.occupation(); // Relue a chaque tour : une FEN importee la remplace
+
+    if ((attendu & ~getTableau()) != manquantes || (getTableau() & ~attendu) != enTrop)
+    {
+      manquantes = attendu & ~getTableau();
+      enTrop = getTableau() & ~attendu;
+      ledPlacement(manquantes, enTrop);
+    }
+
+    if (attendreTableau() && fin)
+    {
+      _del.vider(COUCHE_FIN);
+      fin = false;
+    }
+  }
+}
+
+// compare deux tableaux representes sur 64 bits pour identifier la case differente
+// Retourne le contenue de la case affectee
+template <class Materiel>
+Case Partie<Materiel>::difference(uint64_t vieuxTableau, uint64_t tableauCourant, const Case echiquier[8][8])
+{
+  Difference changements; // Cases qui ont change, trouvees sans parcourir les 64 cases
+  uint32_t debut = Horloge::cycles();
+
+  comparerTableaux(vieuxTableau, tableauCourant, changements);
+  _latenceDifference.enregistrer(Horloge::cycles() - debut);
+
+  TRACE_DETAIL(_traces, SOURCE_JEU, TRACE_DIFFERENCE, changements.leves | changements.poses);
+
+  // Une seule case doit changer a la fois. Sinon, la case retournee est hors de l'echiquier et le joueur est en erreur
+  if (changements.nombre != 1)
+  {
+    TRACE_ERREUR(_traces, SOURCE_JEU, TRACE_CHANGEES, changements.nombre, 1);
+    return Case();
+  }
+
+  return echiquier[changements.cases[0] / TAILLE][changements.cases[0] % TAILLE];
+}
+
+// Est-ce pertinent?
+template <class Materiel>
+void Partie<Materiel>::clearAction()
+{
+  // Change l'espace memoire commencant au premier espace d'actionPossible a la valeur 0 pour tout l'espace occupe par actionPossible
+  memset(_actionPossible, 0, sizeof(_actionPossible));
+}
+
+template <class Materiel>
+void Partie<Materiel>::deplaceTourRoque(const Case &dep, const Case &arriv, const Case echiquier[8][8])
+{
+  uint64_t avant;       // Etat du tableau avant toute modification
+  uint64_t pendant = 0; // Etat du tableau pendant les modifications
+  bool actionValide;    // Indique si la modification est valide
+  Case changement;      // Case qui a change d'etat
+
+  // Affiche la case de depart et la case d'arrivee
+  _del.allumer(COUCHE_SELECTION, bitDel(dep.getLed()), Ruban::Color(0, 255, 255));
+  _del.allumer(COUCHE_COUPS, bitDel(arriv.getLed()), Ruban::Color(0, 255, 0));
+  _del.afficher();
+
+  // Avant la transition
+  avant = getTableau();
+
+  // On retire le pion
+  actionValide = false;
+  while (!actionValide)
+  {
+    attendreTableau();
+
+    // Une piece est retiree
+    if (getTableau() < avant)
+    {
+      // On trouve quelle piece a ete retiree
+      changement = difference(avant, getTableau(), echiquier);
+      if (changement.inbounds(changement.getRangee(), changement.getColonne()) && changement.getLed() == dep.getLed()) // La led peut servir d'identifiant a une case
+      {
+        actionValide = true;
+        // On enregistre le tableau pendant la transition
+        pendant = getTableau();
+      }
+      else
+      {
+        ledErreur(changement, avant);
+      }
+    }
+  }
+
+  // On ajoute une piece
+  actionValide = false;
+  while (!actionValide)
+  {
+    attendreTableau();
+
+    // Une piece est ajoutee
+    if (getTableau() > pendant)
+    {
+      // On trouve quelle piece a ete ajoutee
+      changement = difference(pendant, getTableau(), echiquier);
+      if (changement.inbounds(changement.getRangee(), changement.getColonne()) && changement.getLed() == arriv.getLed()) // La led peut servir d'identifiant a une case
+      {
+        actionValide = true;
+      }
+      else
+      {
+        ledErreur(changement, pendant);
+      }
+    }
+  }
+}
+
+template <class Materiel>
+void Partie<Materiel>::echangePromotion(const Case &piece, const Case echiquier[8][8])
+{
+  uint64_t avant, pendant = 0;
+  bool actionValide;
+  Case changement;
+
+  // Avant la transition
+  avant = getTableau();
+
+  // On retire le pion
+  actionValide = false;
+  while (!actionValide)
+  {
+    attendreTableau();
+
+    // Une piece est retiree
+    if (getTableau() < avant)
+    {
+      // Quelle piece a ete retiree?
+      changement = difference(avant, getTableau(), echiquier);
+      if (changement.inbounds(changement.getRangee(), changement.getColonne()) && changement.getLed() == piece.getLed()) // La led peut servir d'identifiant a une case
+      {
+        actionValide = true;
+        pendant = getTableau(); // pendant la transition
+      }
+      else
+      {
+        ledErreur(changement, avant);
+      }
+    }
+  }
+
+  // On ajoute une piece
+  actionValide = false;
+  while (!actionValide)
+  {
+    attendreTableau();
+
+    // Une piece est ajoutee
+    if (getTableau() > pendant)
+    {
+      // Quelle piece a ete ajoutee?
+      changement = difference(pendant, getTableau(), echiquier);
+      if (changement.inbounds(changement.getRangee(), changement.getColonne()) && changement.getLed() == piece.getLed()) // La led peut servir d'identifiant a une case
+      {
+        actionValide = true;
+      }
+      else
+      {
+        ledErreur(changement, pendant);
+      }
+    }
+  }
+}
+
+// Retourne l'etat du tableau vu par le jeu. Il ne change que par attendreTableau()
+template <class Materiel>
+uint64_t Partie<Materiel>::getTableau()
+{
+  return _tableau;
+}
+
+// Jeu. Retire le prochain changement du tableau de la file, dans l'ordre de lecture
+// Si la file est vide, dort jusqu'a la prochaine publication ou au plus 'ms' millisecondes
+// Les commandes recues sur le port serie sont executees avant l'attente (voir lireCommandes)
+// Vrai si '_tableau' a ete mis a jour
+template <class Materiel>
+bool Partie<Materiel>::attendreTableau(uint32_t ms)
+{
+  EvenementTableau evenement;
+
+  lireCommandes();
+  if (!_evenements.retirer(evenement))
+  {
+    _signal.attendre(ms);
+    if (!_evenements.retirer(evenement))
+    {
+      return false;
+    }
+  }
+
+#if 0
+  Console::ecrire("Evenement : ");
+  print64BIN(evenement.change);
+#endif
+
+  _tableau = evenement.tableau;
+  _tempsTableau = evenement.temps;
+  _touches |= evenement.change;
+  return true;
+}
+
+// Tache de lecture. Ajoute un nouvel etat du tableau a la file et reveille le jeu
+// Aucun verrou : la tache de lecture n'attend jamais le jeu. Faux si la file est pleine, l'etat n'est pas publie
+// L'instantane (getTableauCourant) est mis a jour dans tous les cas
+template <class Materiel>
+bool Partie<Materiel>::publierTableau(uint64_t valeur)
+{
+  EvenementTableau evenement = {valeur, valeur ^ _publie, Horloge::micros()};
+  uint32_t debut = Horloge::cycles();
+
+  _instantane.ecrire(valeur);
+  if (!_evenements.ajouter(evenement))
+  {
+    _filePleine++;
+    return false;
+  }
+  _publie = valeur;
+  _signal.signaler();
+  _latencePublication.enregistrer(Horloge::cycles() - debut);
+  return true;
+}
+
+// Jeu. Lit les caracteres recus sur le port serie et execute chaque commande complete (terminee par une fin de ligne)
+// Le jeu est le seul a lire le port serie : les commandes touchent au journal et a la partie sans verrou
+template <class Materiel>
+void Partie<Materiel>::lireCommandes()
+{
+  int caractere;
+
+  while ((caractere = Console::lire()) >= 0)
+  {
+    if (caractere == '\n' || caractere == '\r')
+    {
+      _commande[_longueurCommande] = '\0';
+      if (_longueurCommande)
+      {
+        executerCommande(_commande);
+      }
+      _longueurCommande = 0;
+    }
+    else if (_longueurCommande < TAILLE_COMMANDE - 1)
+    {
+      _commande[_longueurCommande++] = caractere;
+    }
+  }
+}
+
+// Jeu. Execute une commande du port serie
+//   pgn       Ecrit la partie courante, ou la derniere partie, en PGN
+//   fen       Ecrit la position courante en FEN
+//   fen FEN   Remplace la position a placer avant le debut d'une partie (voir importerFen)
+//   latences  Ecrit les centiles des durees de chaque etape du chemin critique
+//   livre     Ecrit les coups du livre d'ouvertures pour la position courante
+//   moteur blancs|noirs|deux|non [ms [profondeur]]  Choisit les joueurs du Moteur et ses limites par coup (voir choisirMoteur)
+template <class Materiel>
+void Partie<Materiel>::executerCommande(const char *commande)
+{
+  if (!strcmp(commande, "pgn"))
+  {
+    _journal.exporterPgn();
+  }
+  else if (!strcmp(commande, "fen"))
+  {
+    char fen[TAILLE_FEN];
+
+    ecrireFen(_plateau, fen, sizeof(fen));
+    Console::ecrireLigne(fen);
+  }
+  else if (!strncmp(commande, "fen ", 4))
+  {
+    importerFen(commande + 4);
+  }
+  else if (!strcmp(commande, "latences"))
+  {
+    afficheLatences();
+  }
+  else if (!strcmp(commande, "livre"))
+  {
+    afficheLivre();
+  }
+  else if (!strncmp(commande, "moteur", 6) && (commande[6] == ' ' || commande[6] == '\0'))
+  {
+    choisirMoteur(commande + 6);
+  }
+  else
+  {
+    Console::ecrire("Commande inconnue : ");
+    Console::ecrireLigne(commande);
+  }
+}
+
+// Ecrit les centiles des durees de chaque etape, du balayage des senseurs jusqu'a l'ecran
+// Les durees en cycles sont converties en microsecondes. Chaque centile est une borne superieure a 25 % pres
+template <class Materiel>
+void Partie<Materiel>::afficheLatences()
+{
+  uint32_t parMicro = Horloge::cyclesParMicro();
+
+  Console::ecrireLigne("Etape : nombre, p50, p90, p99, max (us)");
+  afficheLatence("Balayage", _latenceBalayage, parMicro);
+  afficheLatence("Publication", _latencePublication, parMicro);
+  afficheLatence("Difference", _latenceDifference, parMicro);
+  afficheLatence("Generation", _latenceGeneration, parMicro);
+  afficheLatence("BougerPiece", _latenceCoups, parMicro);
+  afficheLatence("Echec", _latenceEchec, parMicro);
+  afficheLatence("Composition DEL", _del.latenceComposition(), parMicro);
+  afficheLatence("Show DEL", _del.latenceTransmission(), parMicro);
+  afficheLatence("Ecran OLED", _ecran.latence(), parMicro);
+  afficheLatence("Lecture a DEL", _del.latenceReaction(), 1);
+}
+
+// Ecrit une ligne du rapport des latences. parMicro : unites de l'histogramme par microseconde
+template <class Materiel>
+void Partie<Materiel>::afficheLatence(const char *nom, const Histogramme &histogramme, uint32_t parMicro)
+{
+  const uint8_t centiles[] = {50, 90, 99};
+
+  Console::ecrire(nom);
+  Console::ecrire(" : ");
+  Console::ecrire((unsigned long)histogramme.nombre());
+  for (uint8_t centile : centiles)
+  {
+    Console::ecrire(", ");
+    Console::ecrire((double)histogramme.centile(centile) / parMicro);
+  }
+  Console::ecrire(", ");
+  Console::ecrireLigne((double)histogramme.maximum() / parMicro);
+}
+
+// Jeu. Remplace la position de la partie par 'fen', comme une partie reprise de la sauvegarde
+// Refuse pendant une partie : la position ne change qu'entre deux parties, pendant que les pieces sont placees
+template <class Materiel>
+void Partie<Materiel>::importerFen(const char *fen)
+{
+  Board position;
+
+  if (_enPartie)
+  {
+    Console::ecrireLigne("FEN refusee : partie en cours");
+    return;
+  }
+  if (!lireFen(position, fen))
+  {
+    Console::ecrire("FEN invalide : ");
+    Console::ecrireLigne(fen);
+    return;
+  }
+
+  // Les cases de '_echiquier' sont des vues sur '_plateau' : elles suivent la nouvelle position
+  _plateau = position;
+  _reprise = true;
+  Console::ecrireLigne("FEN importee : placer les pieces");
+}
+
+// Jeu. Choisit les joueurs du Moteur : "blancs", "noirs", "deux" ou "non", suivi du budget en millisecondes
+// et de la profondeur maximale. Un budget de 0 avec une profondeur cherche sans limite de temps : le meme coup a chaque fois
+// Sans parametre, ecrit le choix courant. Le changement vaut des le prochain tour
+template <class Materiel>
+void Partie<Materiel>::choisirMoteur(const char *parametres)
+{
+  const char *noms[] = {"non", "blancs", "noirs", "deux"}; // Indexes par les bits MOTEUR_BLANCS et MOTEUR_NOIRS
+  char nom[8] = "";
+  unsigned long budget = 0;
+  unsigned profondeur = 0;
+
+  sscanf(parametres, " %7s %lu %u", nom, &budget, &profondeur);
+  if (nom[0])
+  {
+    uint8_t i = 0;
+
+    while (i < 4 && strcmp(nom, noms[i]))
+    {
+      i++;
+    }
+    if (i == 4)
+    {
+      Console::ecrire("Moteur inconnu : ");
+      Console::ecrireLigne(nom);
+      return;
+    }
+    _campsMoteur = i;
+    if (budget || profondeur)
+    {
+      _budgetMoteur = budget;
+      _profondeurMoteur = (profondeur < PLY_MAX / 2) ? profondeur : PLY_MAX / 2 - 1;
+    }
+  }
+
+  Console::ecrire("Moteur : ");
+  Console::ecrire(noms[_campsMoteur]);
+  if (_budgetMoteur)
+  {
+    Console::ecrire(", ");
+    Console::ecrire((unsigned long)_budgetMoteur);
+    Console::ecrire(" ms par coup");
+  }
+  if (_profondeurMoteur)
+  {
+    Console::ecrire(", profondeur ");
+    Console::ecrire((int)_profondeurMoteur);
+  }
+  Console::ecrireLigne();
+}
+
+// Indique si le Moteur joue 'joueur' (1 : blancs, -1 : noirs)
+template <class Materiel>
+bool Partie<Materiel>::moteurJoue(short joueur) const
+{
+  return _campsMoteur & (joueur == 1 ? MOTEUR_BLANCS : MOTEUR_NOIRS);
+}
+
+// Jeu. Demande au Moteur le coup du joueur qui a le trait et l'indique sur l'echiquier
+// Une position du livre d'ouvertures est jouee sans recherche (voir Livre.h). Le tableau et le port serie sont lus pendant la recherche. Le coup d'une position deja cherchee est repris
+// sans nouvelle recherche : le joueur a redepose une piece et son tour recommence. COUP_NUL s'il n'y a aucun coup legal
+template <class Materiel>
+Coup Partie<Materiel>::proposerCoup()
+{
+  ResultatRecherche resultat;
+  char san[TAILLE_SAN];
+  uint32_t debut = Horloge::micros();
+  Coup coup;
+
+  if (_clePropose == _plateau.cle() && coupPropose() != COUP_NUL)
+  {
+    ledProposition(coupPropose());
+    return coupPropose();
+  }
+
+  // Le temps sert aussi de hasard : les coups du livre sont tires selon leur poids
+  // Sans limite de temps, le hasard vient de la position : la partie se rejoue a l'identique
+  coup = choisirLivre(_plateau, _budgetMoteur ? debut : (uint32_t)_plateau.cle());
+  if (coup != COUP_NUL)
+  {
+    uint32_t duree = Horloge::micros() - debut;
+
+    ecrireSan(_plateau, coup, san, sizeof(san));
+    Console::ecrire("Livre : ");
+    Console::ecrire(san);
+    Console::ecrire(" en ");
+    Console::ecrire((unsigned long)duree);
+    Console::ecrireLigne(" us");
+  }
+  else
+  {
+    // La derniere position de l'historique est '_plateau' lui-meme
+    _moteur.chercher(_plateau, _budgetMoteur, _profondeurMoteur, _historique, _positionsHistorique - 1);
+    while (!_moteur.resultat(resultat))
+    {
+      attendreTableau();
+    }
+    if (resultat.coup == COUP_NUL)
+    {
+      return COUP_NUL;
+    }
+    coup = resultat.coup;
+
+    _noeudsParSeconde.store(resultat.duree ? (uint64_t)resultat.noeuds * 1000 / resultat.duree : resultat.noeuds,
+                            std::memory_order_relaxed);
+    ecrireSan(_plateau, coup, san, sizeof(san));
+    Console::ecrire("Moteur : ");
+    Console::ecrire(san);
+    Console::ecrire(", profondeur ");
+    Console::ecrire((int)resultat.profondeur);
+    Console::ecrire(", score ");
+    Console::ecrire((int)resultat.score);
+    Console::ecrire(", ");
+    Console::ecrire((unsigned long)resultat.noeuds);
+    Console::ecrire(" noeuds en ");
+    Console::ecrire((unsigned long)resultat.duree);
+    Console::ecrire(" ms, ");
+    Console::ecrire((unsigned long)noeudsParSeconde());
+    Console::ecrireLigne(" noeuds/s");
+  }
+
+  _clePropose = _plateau.cle();
+  _coupPropose.store(coup, std::memory_order_release);
+  ledProposition(coup);
+  return coup;
+}
+
+// Jeu. Ajoute la position du tour a l'historique des repetitions du Moteur. Un tour qui recommence (piece redeposee)
+// ne l'ajoute pas deux fois. Plein, l'historique oublie sa plus vieille position
+template <class Materiel>
+void Partie<Materiel>::noterPosition()
+{
+  uint64_t cle = _plateau.cle();
+
+  if (_positionsHistorique && _historique[_positionsHistorique - 1] == cle)
+  {
+    return;
+  }
+  if (_positionsHistorique == HISTORIQUE_MAX)
+  {
+    memmove(_historique, _historique + 1, (HISTORIQUE_MAX - 1) * sizeof(uint64_t));
+    _positionsHistorique--;
+  }
+  _historique[_positionsHistorique++] = cle;
+}
+
+// Jeu. Annonce le resultat d'une finale des tables (voir Finales.h) quand il change : a l'entree dans la finale,
+// apres une promotion ou une erreur qui perd le gain. Rien hors des tables
+template <class Materiel>
+void Partie<Materiel>::annoncerFinale()
+{
+  short gagnant = 0;
+  TypeFinale finale = sonderFinale(_plateau, gagnant);
+  int8_t annonce = (finale == FINALE_AUCUNE) ? -1 : finale * 3 + gagnant + 1;
+
+  if (annonce == _finaleAnnoncee)
+  {
+    return;
+  }
+  _finaleAnnoncee = annonce;
+  if (finale == FINALE_AUCUNE)
+  {
+    return;
+  }
+  Console::ecrire("Finale ");
+  Console::ecrire(NOMS_FINALES[finale]);
+  Console::ecrireLigne(gagnant > 0 ? " : les blancs gagnent" : gagnant < 0 ? " : les noirs gagnent" : " : nulle");
+}
+
+// Jeu. Ecrit les coups du livre d'ouvertures pour la position courante, le plus joue en premier, avec leur poids
+template <class Materiel>
+void Partie<Materiel>::afficheLivre()
+{
+  Coup coups[COUPS_LIVRE_MAX];
+  uint16_t poids[COUPS_LIVRE_MAX];
+  char san[TAILLE_SAN];
+  int nombre = coupsLivre(_plateau, coups, poids);
+
+  Console::ecrire("Livre :");
+  if (nombre == 0)
+  {
+    Console::ecrire(" position hors du livre");
+  }
+  for (int i = 0; i < nombre; i++)
+  {
+    ecrireSan(_plateau, coups[i], san, sizeof(san));
+    Console::ecrire(' ');
+    Console::ecrire(san);
+    Console::ecrire(" (");
+    Console::ecrire((unsigned int)poids[i]);
+    Console::ecrire(')');
+  }
+  Console::ecrireLigne();
+}
+
+// Retourne l'occupation du plateau sous le meme format que le mot lu par les senseurs
+// Le plateau garde ses bitboards a jour a chaque modification, il n'y a donc rien a recalculer
+// Appele par la partie demo, dans la tache de lecture
+template <class Materiel>
+uint64_t Partie<Materiel>::virtuelleToBits(const Board &plateau)
+{
+  uint64_t bitfield = plateau.occupation();
+
+  TRACE_DETAIL(_traces, SOURCE_LECTURE, TRACE_VIRTUEL, bitfield);
+  return bitfield;
+}
+
+// ------------------------------------ Fonctions DEL ---------------------------------------------------------
+
+// Serpentine pour tester les DEL : une tete blanche laisse du rouge derriere elle, puis l'echiquier apparait
+// Jouee par la tache des DEL. Retourne aussitot
+template <class Materiel>
+void Partie<Materiel>::InitialiseLED()
+{
+  _del.allumer(COUCHE_FIN, ~0ULL, 0); // Noir devant la tete
+  _del.animer(ANIMATION_BALAYAGE, COUCHE_FIN, ~0ULL, Ruban::Color(255, 255, 255), (LEDCOUNT + LARGEUR_BALAYAGE) * 75,
+              false, Ruban::Color(255, 0, 0));
+  ledEchiquier();
+}
+
+// Genere l'eclairage d'un echiquier (Cases blanches et noires) et efface les coups et la selection
+// Les cases noires sont opaques : une DEL eteinte de l'echiquier cache toujours une couche plus basse
+template <class Materiel>
+void Partie<Materiel>::ledEchiquier()
+{
+  uint64_t blanches = 0; // DEL des cases blanches
+
+  for (int rangee = 0; rangee < 8; rangee++)
+  {
+    for (int colonne = 0; colonne < 8; colonne++)
+    {
+      const Case &carre = _echiquier[rangee][colonne];
+      if (carre.getLed() % 2 != 0)
+      {
+        blanches |= bitDel(carre.getLed());
+      }
+    }
+  }
+  _del.allumer(COUCHE_ECHIQUIER, blanches, Ruban::Color(255, 255, 255));
+  _del.allumer(COUCHE_ECHIQUIER, ~blanches, 0);
+  _del.vider(COUCHE_COUPS);
+  _del.vider(COUCHE_SELECTION);
+  _del.afficher();
+}
+
+// Guide de placement : cases ou il manque une piece en vert, pieces en trop en rouge
+template <class Materiel>
+void Partie<Materiel>::ledPlacement(uint64_t manquantes, uint64_t enTrop)
+{
+  _del.vider(COUCHE_COUPS);
+  _del.allumer(COUCHE_COUPS, delsCases(manquantes), Ruban::Color(0, 255, 0));
+  _del.vider(COUCHE_ERREUR);
+  _del.allumer(COUCHE_ERREUR, delsCases(enTrop), Ruban::Color(255, 0, 0));
+  _del.afficher();
+}
+
+// Retourne les DEL d'un masque de cases
+template <class Materiel>
+uint64_t Partie<Materiel>::delsCases(uint64_t cases)
+{
+  uint64_t dels = 0;
+
+  while (cases)
+  {
+    short position = extraireCase(cases);
+    dels |= bitDel(_echiquier[position / TAILLE][position % TAILLE].getLed());
+  }
+  return dels;
+}
+
+// Affiche la piece soulevee (cyan) et ses cases d'arrivee possibles (vert)
+template <class Materiel>
+void Partie<Materiel>::ledAction(int positions)
+{
+  int colonne, rangee;
+  uint64_t arrivees = 0; // DEL des cases d'arrivee
+  colonne = _actionPossible[0].fromCol;
+  rangee = _actionPossible[0].fromRow;
+  _del.allumer(COUCHE_SELECTION, bitDel(_echiquier[rangee][colonne].getLed()), Ruban::Color(0, 255, 255)); // Cyan
+
+  for (int i = 1; i < positions; i++)
+  {
+    colonne = _actionPossible[i].toCol;
+    rangee = _actionPossible[i].toRow;
+    arrivees |= bitDel(_echiquier[rangee][colonne].getLed()); // On va chercher l'adresse de la DEL a cette case
+  }
+  _del.allumer(COUCHE_COUPS, arrivees, Ruban::Color(0, 255, 0)); // vert
+
+  // La reaction est mesuree de la lecture qui a vu la piece soulevee jusqu'a l'apparition des cases vertes
+  _del.afficher(_tempsTableau);
+}
+
+// Allume la case en erreur jusqu'au retour du tableau a son etat precedent
+// L'erreur a sa propre couche : l'effacer fait reapparaitre ce qui etait dessous, coup possible compris
+template <class Materiel>
+void Partie<Materiel>::ledErreur(const Case &erreur, uint64_t tableauPrecedent)
+{
+  uint64_t del = erreur.inbounds(erreur.getRangee(), erreur.getColonne()) ? bitDel(erreur.getLed()) : 0;
+
+  Console::ecrire("Erreur a ");
+  Console::ecrireLigne(erreur.getNom());
+
+#if 0
+  afficheTableauDetail();
+#endif
+
+  if (del)
+  {
+    _del.allumer(COUCHE_ERREUR, del, Ruban::Color(255, 0, 0));
+    _del.afficher();
+  }
+
+  while (getTableau() != tableauPrecedent)
+  {
+    attendreTableau();
+  }
+  if (del)
+  {
+    _del.eteindre(COUCHE_ERREUR, del);
+    _del.afficher();
+  }
+}
+
+// Fait pulser en rouge la case du roi de 'joueur' s'il est en echec, sinon eteint l'alerte
+template <class Materiel>
+void Partie<Materiel>::ledEchec(int joueur)
+{
+  short roi = _plateau.roi(joueur);
+  uint32_t debut = Horloge::cycles();
+  bool echec = roi >= 0 && _plateau.echecs(joueur);
+
+  _latenceEchec.enregistrer(Horloge::cycles() - debut);
+  _del.arreter(COUCHE_ALERTE);
+  _del.vider(COUCHE_ALERTE);
+  if (echec)
+  {
+    _del.animer(ANIMATION_PULSATION, COUCHE_ALERTE, bitDel(_echiquier[roi / TAILLE][roi % TAILLE].getLed()),
+                Ruban::Color(255, 0, 0), 800);
+  }
+  _del.afficher();
+}
+
+// Indique le coup du Moteur : la case de depart en cyan et la case d'arrivee en vert, comme une piece soulevee
+template <class Materiel>
+void Partie<Materiel>::ledProposition(Coup coup)
+{
+  _del.allumer(COUCHE_SELECTION, delsCases(bitCase(departCoup(coup))), Ruban::Color(0, 255, 255));
+  _del.allumer(COUCHE_COUPS, delsCases(bitCase(arriveeCoup(coup))), Ruban::Color(0, 255, 0));
+  _del.afficher();
+}
+
+// Fin de partie. Gagnant 1 (blancs) : DEL 32 a 63 en vert et 0 a 31 en rouge. Gagnant -1 (noirs) : l'inverse
+// Les deux moities sont balayees en meme temps. L'image reste jusqu'au debut de la prochaine partie
+template <class Materiel>
+void Partie<Materiel>::ledFin(int gagnant)
+{
+  uint64_t haut = 0xFFFFFFFF00000000ULL; // DEL 32 a 63
+  uint32_t vert = Ruban::Color(0, 255, 0);
+  uint32_t rouge = Ruban::Color(255, 0, 0);
+  uint32_t blanc = Ruban::Color(255, 255, 255);
+
+  _del.arreter(COUCHE_ALERTE);
+  _del.vider(COUCHE_ALERTE);
+  _del.animer(ANIMATION_BALAYAGE, COUCHE_FIN, haut, blanc, 1000, true, gagnant == 1 ? vert : rouge);
+  _del.animer(ANIMATION_BALAYAGE, COUCHE_FIN, ~haut, blanc, 1000, true, gagnant == 1 ? rouge : vert);
+}
+
+// ------------------------------------Fonctions debug ---------------------------------------------------------
+
+// Affiche la position des pieces
+// TODO Decrementer J pour tous les afficheTableau
+template <class Materiel>
+void Partie<Materiel>::afficheTableauPiece(Case (&echiquier)[8][8])
+{
+  int k = 0; // Numero de la rangee du jeu
+
+  for (int i = 0; i < 17; i++)
+  {
+    // Dessine une ligne pour diviser les rangees de la grille de jeu
+    if (i % 2 == 0)
+    {
+      Console::ecrireLigne("-----------------");
+    }
+    else
+    {
+      for (int j = 7; j >= 0; j--)
+      {
+        Console::ecrire("|"); // Separe les colonnes de la grille de jeu
+        Console::ecrire(echiquier[k][j].getPiece());
+      }
+      Console::ecrireLigne("|");
+      k++;
+    }
+  }
+  // Console::ecrireLigne("fin\n\n");
+}
+
+// Affiche si une case est occupee ou non
+template <class Materiel>
+void Partie<Materiel>::afficheTableauPresence()
+{
+  uint64_t valeur = getTableauCourant(); // representation 64-bit du tableau. TODO Trouver un meilleur nom?
+
+  for (int i = 0; i < 64; i++)
+  {
+    // Retour a la ligne apres 8 characteres
+    if (i % 8 == 0)
+      Console::ecrireLigne();
+
+    Console::ecrire((int)bitRead(valeur, 0)); // Imprime la valeur du plus petit bit de valeur
+    Console::ecrire(" ");
+    valeur >>= 1ULL; // Tasse 64 bits vers la droite. Le plus petit bit est retirer et 0 est ajoute comme plus grand bit
+  }
+  Console::ecrireLigne("\n -------------------");
+}
+
+// Affiche le retour d'un multiplexeur
+template <class Materiel>
+void Partie<Materiel>::afficheMultiplexeur()
+{
+  int i = 7;
+  Gpio::ecrire(MUX1_E, LOW);
+  Gpio::ecrire(MUX2_E, HIGH);
+  Gpio::ecrire(MUX3_E, HIGH);
+  Gpio::ecrire(MUX4_E, HIGH);
+
+  Gpio::ecrire(MUX_S0, bitRead(i, 0));
+  Gpio::ecrire(MUX_S1, bitRead(i, 1));
+  Gpio::ecrire(MUX_S2, bitRead(i, 2));
+  Gpio::ecrire(MUX_S3, bitRead(i, 3));
+
+  Console::ecrire(Gpio::lire(RS_DATA));
+  Console::ecrire(" ");
+
+  Console::ecrireLigne();
+}
+
+// Affiche le temps de stabilisation (us) de chaque entree des multiplexeurs. Une ligne par multiplexeur
+template <class Materiel>
+void Partie<Materiel>::afficheStabilisation()
+{
+  Console::ecrireLigne("Stabilisation des multiplexeurs (us) :");
+  for (short multiplexeur = 0; multiplexeur < 4; multiplexeur++)
+  {
+    for (short canal = 0; canal < 16; canal++)
+    {
+      Console::ecrire((int)_balayeur.getStabilisation(16 * multiplexeur + canal));
+      Console::ecrire(" ");
+    }
+    Console::ecrireLigne();
+  }
+}
+
+// Affiche quel joueur occupe les cases
+// TODO Changer k et j pour rangee et colonne pour clarifier
+template <class Materiel>
+void Partie<Materiel>::afficheTableauJoueur()
+{
+  int k = 0; // Numero de la rangee du jeu
+
+  for (int i = 0; i < 17; i++)
+  {
+    // Dessine une ligne pour diviser les rangees de la grille de jeu
+    if (i % 2 == 0)
+    {
+      Console::ecrireLigne("-----------------");
+    }
+    else
+    {
+      for (int j = 0; j < 8; j++)
+      {
+        Console::ecrire("|"); // Separe les colonnes de la grille de jeu
+        Console::ecrire(_echiquier[k][j].getJoueur());
+      }
+      Console::ecrireLigne("|");
+      k++;
+    }
+  }
+  Console::ecrireLigne("fin\n\n");
+}
+
+// Affiche le nom des cases
+// TODO Changer k et j pour rangee et colonne pour clarifier
+template <class Materiel>
+void Partie<Materiel>::afficheTableauNom()
+{
+  int k = 0; // Numero de la rangee du jeu
+
+  // Dessine une ligne pour diviser les rangees de la grille de jeu
+  for (int i = 0; i < 17; i++)
+  {
+    if (i % 2 == 0)
+    {
+      Console::ecrireLigne("-------------------------");
+    }
+    else
+    {
+      for (int j = 0; j < 8; j++)
+      {
+        Console::ecrire("|"); // Separe les colonnes de la grille de jeu
+        Console::ecrire(_echiquier[k][j].getNom());
+      }
+      Console::ecrireLigne("|");
+      k++;
+    }
+  }
+  Console::ecrireLigne("fin\n\n");
+}
+
+// Affiche en detail le contenue des cases
+template <class Materiel>
+void Partie<Materiel>::afficheTableauDetail()
+{
+  char texte[32];
+
+  for (int i = 0; i < 8; i++)
+  {
+    for (int j = 0; j < 8; j++)
+    {
+      _echiquier[i][j].readCase(texte, sizeof(texte));
+      Console::ecrire(texte);
+      Console::ecrire('\t');
+    }
+    Console::ecrireLigne();
+  }
+  Console::ecrireLigne("fin\n\n");
+}
+
+// Permet d'imprimer 64 bits d'information, tout de suite. Hors des fonctions de debug, utiliser les traces (voir Traces.h)
+template <class Materiel>
+void Partie<Materiel>::print64BIN(uint64_t valeur)
+{
+  Traces<Materiel>::ecrireBinaire(valeur);
+  Console::ecrireLigne();
+}
+
+#endif
@@ -0,0 +1,136 @@
+/*
+Sauvegarde.h - Position de la partie en cours, gardee en NVS apres chaque coup
+La position est une copie compacte du Board (un octet par case : piece, joueur, "a bouge" pour les droits de roque
+et "vulnerable" pour la prise en passant) avec le trait, soit l'equivalent d'une FEN en 76 octets.
+Deux copies sont ecrites en alternance, chacune avec un numero et un CRC-32 : une coupure pendant une ecriture
+n'abime qu'une copie, et la plus recente des copies valides est reprise au demarrage.
+*/
+
+#ifndef Sauvegarde_h
+
+#define Sauvegarde_h
+
+#include <stdint.h>
+#include <stddef.h>
+#include <Board.h>
+
+#define CLE_SAUVEGARDE_A "partie_a" // Cles NVS des deux copies. Les numeros pairs vont dans A, les impairs dans B
+#define CLE_SAUVEGARDE_B "partie_b"
+
+// Structure. Une copie de la partie en cours
+struct SauvegardePartie
+{
+  uint32_t numero;     // Augmente a chaque ecriture
+  Instantane position; // Pieces et indicateurs de chaque case
+  int8_t trait;        // 1 : blancs, -1 : noirs
+  uint8_t enCours;     // 0 si aucune partie n'est a reprendre
+  uint16_t reserve;    // Toujours 0
+  uint32_t crc;        // CRC-32 des champs precedents
+};
+
+// Retourne le CRC-32 (polynome 0xEDB88320, celui de zlib) de 'taille' octets
+inline uint32_t crc32(const void *donnees, size_t taille)
+{
+  const uint8_t *octets = static_cast<const uint8_t *>(donnees);
+  uint32_t crc = 0xFFFFFFFF;
+
+  for (size_t i = 0; i < taille; i++)
+  {
+    crc ^= octets[i];
+    for (uint8_t bit = 0; bit < 8; bit++)
+    {
+      crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+    }
+  }
+  return ~crc;
+}
+
+// Objet. Sauvegarde de la partie en cours en memoire non volatile
+template <class Materiel>
+class Sauvegarde
+{
+public:
+  bool charger(Board &plateau);
+  bool ecrire(const Board &plateau);
+  bool terminer();
+
+private:
+  using Memoire = typename Materiel::Memoire;
+
+  // Un _ devant une variable indique que celle-ci est propre a une instance de type Sauvegarde
+
+  uint32_t _numero = 0; // Numero de la derniere copie lue ou ecrite
+
+  bool lire(const char *cle, SauvegardePartie &copie);
+  bool ecrire(SauvegardePartie &copie);
+};
+
+// Remplace 'plateau' par la plus recente des copies valides. Faux si aucune partie n'est a reprendre
+// Le numero des prochaines copies suit celui de la plus recente, valide ou non
+template <class Materiel>
+bool Sauvegarde<Materiel>::charger(Board &plateau)
+{
+  SauvegardePartie copies[2];
+  bool valides[2] = {lire(CLE_SAUVEGARDE_A, copies[0]), lire(CLE_SAUVEGARDE_B, copies[1])};
+  int8_t choisie = -1;
+
+  for (uint8_t i = 0; i < 2; i++)
+  {
+    if (valides[i] && (choisie < 0 || (int32_t)(copies[i].numero - copies[choisie].numero) > 0))
+    {
+      choisie = i;
+    }
+  }
+  if (choisie < 0)
+  {
+    return false;
+  }
+
+  _numero = copies[choisie].numero;
+  if (!copies[choisie].enCours)
+  {
+    return false;
+  }
+  plateau.setTrait(copies[choisie].trait);
+  plateau.restaurer(copies[choisie].position);
+  return true;
+}
+
+// Ecrit la position de la partie en cours dans la copie la plus ancienne
+template <class Materiel>
+bool Sauvegarde<Materiel>::ecrire(const Board &plateau)
+{
+  SauvegardePartie copie = {};
+
+  copie.position = plateau.instantane();
+  copie.trait = plateau.getTrait();
+  copie.enCours = 1;
+  return ecrire(copie);
+}
+
+// Fin de la partie : plus rien n'est a reprendre au prochain demarrage
+template <class Materiel>
+bool Sauvegarde<Materiel>::terminer()
+{
+  SauvegardePartie copie = {};
+
+  return ecrire(copie);
+}
+
+// Lit une copie. Faux si elle n'existe pas ou si son CRC ne correspond pas
+template <class Materiel>
+bool Sauvegarde<Materiel>::lire(const char *cle, SauvegardePartie &copie)
+{
+  return Memoire::lire(cle, &copie, sizeof(copie)) && copie.crc == crc32(&copie, offsetof(SauvegardePartie, crc));
+}
+
+// Numerote une copie, calcule son CRC et l'ecrit a la place de la plus ancienne
+template <class Materiel>
+bool Sauvegarde<Materiel>::ecrire(SauvegardePartie &copie)
+{
+  copie.numero = ++_numero;
+  copie.crc = crc32(&copie, offsetof(SauvegardePartie, crc));
+  return Memoire::ecrire((copie.numero & 1) ? CLE_SAUVEGARDE_B : CLE_SAUVEGARDE_A, &copie, sizeof(copie));
+}
+
+#endif
@@ -0,0 +1,472 @@
+/*
+TacheDel.h - Tache des DEL : animations et transmission du ruban, hors du chemin du jeu
+Le jeu ne touche jamais au ruban. Il ajoute des commandes (dessiner dans une couche, afficher, animer)
+a une file sans verrou et repart aussitot. La tache des DEL, de basse priorite, applique les commandes
+au Compositeur, fait avancer les animations a PERIODE_IMAGE_DEL_MS et attend elle-meme la fin de chaque show().
+Sur l'ESP32, Adafruit_NeoPixel transmet deja par le peripherique RMT : c'est l'attente de la transmission,
+et non plus le temps d'une lecture des senseurs ou d'un tour de jeu, qui est deplacee sur cette tache.
+*/
+
+#ifndef TacheDel_h
+
+#define TacheDel_h
+
+#include <stdint.h>
+#include <atomic>
+#include "Compositeur.h"
+#include "FileEvenements.h"
+#include "Histogramme.h"
+
+#define PERIODE_IMAGE_DEL_MS 20 // 50 images par seconde pendant une animation
+#define VEILLE_DEL_MS 1000      // Attente maximale de la tache sans animation ni commande
+#define TAILLE_FILE_DEL 64      // Commandes en attente de la tache. Puissance de 2
+#define MAX_ANIMATIONS 4        // Animations qui peuvent jouer en meme temps
+#define LARGEUR_BALAYAGE 8      // DEL allumees a la tete d'un balayage
+
+// Animations de la ligne du temps
+enum TypeAnimation
+{
+  ANIMATION_FONDU,     // Du noir a 'couleur' en 'duree' ms
+  ANIMATION_PULSATION, // Monte et descend de 'couleur' toutes les 'duree' ms, jusqu'a arreter()
+  ANIMATION_BALAYAGE   // Une tete de 'couleur' parcourt les DEL en 'duree' ms et laisse 'fond' derriere elle
+};
+
+// Structure. Une animation en cours dans une couche
+struct AnimationDel
+{
+  uint64_t dels;    // DEL animees (bit 'del'). Un balayage les parcourt en ordre croissant
+  uint32_t couleur; // Couleur de l'animation
+  uint32_t fond;    // Balayage seulement : couleur laissee derriere la tete
+  uint32_t debut;   // Instant du debut (millis)
+  uint16_t duree;   // Duree, ou periode d'une pulsation (ms)
+  uint8_t type;     // TypeAnimation
+  uint8_t couche;   // CoucheDel
+  bool garder;      // A la fin, garde la derniere image. Sinon, les DEL redeviennent transparentes
+  bool active;      // Faux si la place est libre
+};
+
+// Structure. Commande du jeu a la tache des DEL
+struct CommandeDel
+{
+  enum Type : uint8_t
+  {
+    ALLUMER,
+    ETEINDRE,
+    VIDER,
+    AFFICHER,
+    ANIMER,
+    ARRETER
+  };
+
+  Type type;
+  AnimationDel animation; // 'dels', 'couleur' et 'couche' servent aussi aux commandes de dessin
+  uint32_t origine;       // AFFICHER : instant (micros) de la lecture du tableau qui a cause l'image. 0 si aucune
+};
+
+// Objet. Possede le ruban de DEL et sa tache
+// Les fonctions publiques, sauf envois(), doivent etre appelees par une seule tache : celle du jeu
+template <class Materiel>
+class TacheDel
+{
+public:
+  using Ruban = typename Materiel::Ruban;
+
+  TacheDel(uint16_t nombre, int16_t broche);
+
+  void demarrer(uint8_t luminosite, uint8_t priorite, uint8_t coeur);
+  void allumer(CoucheDel couche, uint64_t dels, uint32_t couleur);
+  void eteindre(CoucheDel couche, uint64_t dels);
+  void vider(CoucheDel couche);
+  void afficher(uint32_t origine = 0);
+  void animer(TypeAnimation type, CoucheDel couche, uint64_t dels, uint32_t couleur, uint16_t duree,
+              bool garder = false, uint32_t fond = 0);
+  void arreter(CoucheDel couche);
+  uint32_t envois() const;
+  const Histogramme &latenceComposition() const;
+  const Histogramme &latenceTransmission() const;
+  const Histogramme &latenceReaction() const;
+
+private:
+  using Horloge = typename Materiel::Horloge;
+  using Taches = typename Materiel::Taches;
+
+  // Un _ devant une variable indique que celle-ci est propre a une instance de type TacheDel
+
+  Ruban _ruban;                                                // DEL adressables sous les cases. Propre a la tache des DEL
+  Compositeur<Ruban> _compositeur;                             // Image composee. Propre a la tache des DEL
+  AnimationDel _animations[MAX_ANIMATIONS] = {};               // Ligne du temps. Propre a la tache des DEL
+  FileEvenements<CommandeDel, TAILLE_FILE_DEL> _commandes;     // Du jeu vers la tache des DEL
+  typename Taches::Signal _signal;                             // Reveille la tache a chaque image demandee
+  std::atomic<uint32_t> _envois{0};                            // Copie de _compositeur.envois(), lisible de partout
+  Histogramme _composition;                                    // Cycles pour composer une image
+  Histogramme _transmission;                                   // Cycles d'un show()
+  Histogramme _reaction;                                       // Microsecondes de la lecture du tableau a la fin du show()
+
+  static void tache(void *del);
+  void executer();
+  void envoyer(const CommandeDel &commande);
+  bool appliquer(const CommandeDel &commande, uint32_t maintenant);
+  bool animer(uint32_t maintenant);
+  static uint32_t attenuer(uint32_t couleur, uint16_t niveau);
+};
+
+// Constructeur. Le ruban est cree, mais pas encore demarre. Voir demarrer()
+template <class Materiel>
+TacheDel<Materiel>::TacheDel(uint16_t nombre, int16_t broche) : _ruban(nombre, broche), _compositeur(_ruban)
+{
+}
+
+// Demarre le ruban, puis la tache qui en devient la seule proprietaire
+template <class Materiel>
+void TacheDel<Materiel>::demarrer(uint8_t luminosite, uint8_t priorite, uint8_t coeur)
+{
+  _ruban.begin();
+  _ruban.show();
+  _ruban.setBrightness(luminosite); // sur 255
+
+  Taches::creer(
+      tache,
+      "del",
+      4096,
+      this,
+      priorite,
+      coeur);
+}
+
+// Dessine 'couleur' sur les DEL 'dels' d'une couche. Visible au prochain afficher()
+template <class Materiel>
+void TacheDel<Materiel>::allumer(CoucheDel couche, uint64_t dels, uint32_t couleur)
+{
+  CommandeDel commande = {};
+
+  commande.type = CommandeDel::ALLUMER;
+  commande.animation.couche = couche;
+  commande.animation.dels = dels;
+  commande.animation.couleur = couleur;
+  envoyer(commande);
+}
+
+// Rend les DEL 'dels' d'une couche transparentes. Visible au prochain afficher()
+template <class Materiel>
+void TacheDel<Materiel>::eteindre(CoucheDel couche, uint64_t dels)
+{
+  CommandeDel commande = {};
+
+  commande.type = CommandeDel::ETEINDRE;
+  commande.animation.couche = couche;
+  commande.animation.dels = dels;
+  envoyer(commande);
+}
+
+// Rend toute une couche transparente. Visible au prochain afficher()
+template <class Materiel>
+void TacheDel<Materiel>::vider(CoucheDel couche)
+{
+  CommandeDel commande = {};
+
+  commande.type = CommandeDel::VIDER;
+  commande.animation.couche = couche;
+  envoyer(commande);
+}
+
+// Demande la transmission de l'image. Retourne sans attendre le ruban
+// origine : instant (micros) de la lecture du tableau a laquelle l'image repond. Mesure la reaction (voir latenceReaction)
+template <class Materiel>
+void TacheDel<Materiel>::afficher(uint32_t origine)
+{
+  CommandeDel commande = {};
+
+  commande.type = CommandeDel::AFFICHER;
+  commande.origine = origine;
+  envoyer(commande);
+  _signal.signaler();
+}
+
+// Ajoute une animation a la ligne du temps. Elle remplace les animations de la meme couche sur les memes DEL
+template <class Materiel>
+void TacheDel<Materiel>::animer(TypeAnimation type, CoucheDel couche, uint64_t dels, uint32_t couleur, uint16_t duree,
+                                bool garder, uint32_t fond)
+{
+  CommandeDel commande = {};
+
+  commande.type = CommandeDel::ANIMER;
+  commande.animation.type = type;
+  commande.animation.couche = couche;
+  commande.animation.dels = dels;
+  commande.animation.couleur = couleur;
+  commande.animation.fond = fond;
+  commande.animation.duree = duree ? duree : 1;
+  commande.animation.garder = garder;
+  envoyer(commande);
+  _signal.signaler();
+}
+
+// Arrete les animations d'une couche. Leurs DEL gardent leur derniere couleur (voir vider)
+template <class Materiel>
+void TacheDel<Materiel>::arreter(CoucheDel couche)
+{
+  CommandeDel commande = {};
+
+  commande.type = CommandeDel::ARRETER;
+  commande.animation.couche = couche;
+  envoyer(commande);
+}
+
+// Retourne le nombre d'images transmises au ruban depuis le demarrage. Peut etre appele de n'importe quelle tache
+template <class Materiel>
+uint32_t TacheDel<Materiel>::envois() const
+{
+  return _envois.load(std::memory_order_relaxed);
+}
+
+// Retourne les cycles pour composer une image (voir Compositeur::composer). Peut etre lu de n'importe quelle tache
+template <class Materiel>
+const Histogramme &TacheDel<Materiel>::latenceComposition() const
+{
+  return _composition;
+}
+
+// Retourne les cycles de chaque transmission du ruban (show()). Peut etre lu de n'importe quelle tache
+template <class Materiel>
+const Histogramme &TacheDel<Materiel>::latenceTransmission() const
+{
+  return _transmission;
+}
+
+// Retourne les microsecondes entre une lecture du tableau et la fin du show() de l'image qui y repond
+// Seules les images demandees avec une origine sont comptees. Peut etre lu de n'importe quelle tache
+template <class Materiel>
+const Histogramme &TacheDel<Materiel>::latenceReaction() const
+{
+  return _reaction;
+}
+
+// Point d'entree de la tache des DEL. 'del' est l'instance qui a cree la tache
+template <class Materiel>
+void TacheDel<Materiel>::tache(void *del)
+{
+  static_cast<TacheDel *>(del)->executer();
+}
+
+// Boucle de la tache des DEL
+// Les commandes sont appliquees des leur arrivee. Les animations avancent d'une image toutes les PERIODE_IMAGE_DEL_MS
+template <class Materiel>
+void TacheDel<Materiel>::executer()
+{
+  uint32_t prochaineImage = Horloge::millis(); // Instant de la prochaine image des animations
+  bool animation = false;                      // Une animation joue
+  uint32_t origine = 0;                        // Plus vieille lecture du tableau qui attend son image. 0 si aucune
+  CommandeDel commande;
+
+  while (Taches::actif())
+  {
+    uint32_t maintenant = Horloge::millis();
+    bool image = false; // L'image doit etre composee
+
+    while (_commandes.retirer(commande))
+    {
+      image |= appliquer(commande, maintenant);
+      if (commande.origine && !origine)
+      {
+        origine = commande.origine;
+      }
+      if (commande.type == CommandeDel::ANIMER)
+      {
+        prochaineImage = maintenant; // Premiere image tout de suite
+      }
+    }
+
+    animation = false;
+    for (const AnimationDel &courante : _animations)
+    {
+      animation |= courante.active;
+    }
+    if (animation && (int32_t)(maintenant - prochaineImage) >= 0)
+    {
+      animation = animer(maintenant);
+      image = true;
+      prochaineImage += PERIODE_IMAGE_DEL_MS;
+      if ((int32_t)(maintenant - prochaineImage) >= 0)
+      {
+        prochaineImage = maintenant + PERIODE_IMAGE_DEL_MS; // En retard : les images sautees ne sont pas rattrapees
+      }
+    }
+
+    if (image)
+    {
+      uint32_t debut = Horloge::cycles();
+      bool change = _compositeur.composer();
+
+      _composition.enregistrer(Horloge::cycles() - debut);
+      if (change)
+      {
+        debut = Horloge::cycles();
+        _compositeur.transmettre();
+        _transmission.enregistrer(Horloge::cycles() - debut);
+        _envois.store(_compositeur.envois(), std::memory_order_relaxed);
+        if (origine)
+        {
+          _reaction.enregistrer(Horloge::micros() - origine);
+        }
+      }
+      origine = 0;
+    }
+
+    if (animation)
+    {
+      int32_t restant = (int32_t)(prochaineImage - Horloge::millis());
+      _signal.attendre(restant > 0 ? restant : 0);
+    }
+    else
+    {
+      _signal.attendre(VEILLE_DEL_MS);
+    }
+  }
+}
+
+// Jeu. Ajoute une commande a la file. Si la tache des DEL a pris du retard au point de remplir la file,
+// attend qu'une place se libere plutot que de perdre une partie de l'image
+template <class Materiel>
+void TacheDel<Materiel>::envoyer(const CommandeDel &commande)
+{
+  while (!_commandes.ajouter(commande))
+  {
+    _signal.signaler();
+    Horloge::attendre(1);
+  }
+}
+
+// Tache des DEL. Applique une commande du jeu. Vrai si l'image doit etre composee
+template <class Materiel>
+bool TacheDel<Materiel>::appliquer(const CommandeDel &commande, uint32_t maintenant)
+{
+  const AnimationDel &animation = commande.animation;
+  CoucheDel couche = (CoucheDel)animation.couche;
+  AnimationDel *place = nullptr;
+
+  switch (commande.type)
+  {
+  case CommandeDel::ALLUMER:
+    _compositeur.allumer(couche, animation.dels, animation.couleur);
+    return false;
+  case CommandeDel::ETEINDRE:
+    _compositeur.eteindre(couche, animation.dels);
+    return false;
+  case CommandeDel::VIDER:
+    _compositeur.vider(couche);
+    return false;
+  case CommandeDel::AFFICHER:
+    return true;
+  case CommandeDel::ARRETER:
+    for (AnimationDel &courante : _animations)
+    {
+      if (courante.couche == couche)
+      {
+        courante.active = false;
+      }
+    }
+    return false;
+  case CommandeDel::ANIMER:
+    // Remplace les animations de la meme couche sur les memes DEL, sinon prend une place libre ou la plus ancienne
+    for (AnimationDel &courante : _animations)
+    {
+      if (courante.active && courante.couche == couche && (courante.dels & animation.dels))
+      {
+        courante.active = false;
+      }
+    }
+    for (AnimationDel &courante : _animations)
+    {
+      if (!courante.active)
+      {
+        place = &courante;
+        break;
+      }
+      if (!place || (int32_t)(courante.debut - place->debut) < 0)
+      {
+        place = &courante;
+      }
+    }
+    *place = animation;
+    place->debut = maintenant;
+    place->active = true;
+    return false;
+  }
+  return false;
+}
+
+// Tache des DEL. Dessine l'image courante de chaque animation dans sa couche
+// Retourne vrai s'il reste une animation en cours
+template <class Materiel>
+bool TacheDel<Materiel>::animer(uint32_t maintenant)
+{
+  bool enCours = false;
+
+  for (AnimationDel &animation : _animations)
+  {
+    if (!animation.active)
+    {
+      continue;
+    }
+
+    CoucheDel couche = (CoucheDel)animation.couche;
+    uint32_t ecoule = maintenant - animation.debut;
+    bool fini = animation.type != ANIMATION_PULSATION && ecoule >= animation.duree;
+
+    if (fini)
+    {
+      animation.active = false;
+      if (!animation.garder)
+      {
+        _compositeur.eteindre(couche, animation.dels);
+        continue;
+      }
+      ecoule = animation.duree;
+    }
+    enCours |= animation.active;
+
+    switch (animation.type)
+    {
+    case ANIMATION_FONDU:
+      _compositeur.allumer(couche, animation.dels, attenuer(animation.couleur, ecoule * 256 / animation.duree));
+      break;
+    case ANIMATION_PULSATION:
+    {
+      uint32_t phase = ecoule % animation.duree * 512 / animation.duree; // 0 a 511 : monte, puis descend
+      _compositeur.allumer(couche, animation.dels, attenuer(animation.couleur, phase < 256 ? phase : 511 - phase));
+      break;
+    }
+    case ANIMATION_BALAYAGE:
+    {
+      // La tete avance de 0 a (nombre de DEL + LARGEUR_BALAYAGE) : a la fin, toutes les DEL ont la couleur du fond
+      uint32_t etapes = __builtin_popcountll(animation.dels) + LARGEUR_BALAYAGE;
+      uint32_t tete = fini ? etapes : ecoule * etapes / animation.duree;
+      uint64_t dels = animation.dels;
+
+      for (uint32_t rang = 0; dels && rang < tete; rang++)
+      {
+        uint64_t del = dels & (~dels + 1); // DEL de ce rang
+        _compositeur.allumer(couche, del, rang + LARGEUR_BALAYAGE < tete ? animation.fond : animation.couleur);
+        dels ^= del;
+      }
+      break;
+    }
+    }
+  }
+  return enCours;
+}
+
+// Multiplie chaque composante de 'couleur' par niveau / 256 (0 a 256)
+template <class Materiel>
+uint32_t TacheDel<Materiel>::attenuer(uint32_t couleur, uint16_t niveau)
+{
+  uint32_t resultat = 0;
+
+  for (uint8_t decalage = 0; decalage < 32; decalage += 8)
+  {
+    resultat |= (((couleur >> decalage) & 0xFF) * niveau >> 8) << decalage;
+  }
+  return resultat;
+}
+
+#endif
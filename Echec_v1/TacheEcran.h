@@ -0,0 +1,245 @@
+/*
+TacheEcran.h - Tache de l'ecran OLED : dessin, boutons de l'ecran et transmission par pages
+Le jeu ne touche jamais a l'ecran. Il demande un ecran (titre, logo, remise a zero) par une file sans verrou
+et repart aussitot. La tache dessine l'ecran demande seulement s'il n'est pas deja affiche, puis compare
+chacune des 8 pages (bandes de 8 rangees de pixels) avec la derniere image transmise et n'envoie que
+les pages changees sur le bus I2C. Les boutons qui choisissent le logo ou le titre sont lus ici,
+toutes les PERIODE_BOUTONS_MS, et non plus par la tache de lecture des senseurs.
+*/
+
+#ifndef TacheEcran_h
+
+#define TacheEcran_h
+
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+#include "Definition.h"
+#include "FileEvenements.h"
+#include "Histogramme.h"
+
+#define SCREEN_WIDTH 128    // Largeur de l'ecran OLED en pixels
+#define SCREEN_HEIGHT 64    // Hauteur de l'ecran OLED en pixels
+#define OLED_RESET 0        // Reset pin # (or -1 if sharing Arduino reset pin)
+#define SCREEN_ADDRESS 0x3C // Adresse de l'ecran. Verifiez dans la datasheet pour la bonne adresse si changee
+#define PAGES_ECRAN (SCREEN_HEIGHT / 8) // Une page : 8 rangees de pixels, un octet par colonne
+#define TAILLE_FILE_ECRAN 8 // Demandes en attente de la tache. Puissance de 2
+
+// Ecrans que le jeu peut demander
+enum EcranJeu : uint8_t
+{
+  ECRAN_VIDE, // Rien d'affiche. Etat au demarrage
+  ECRAN_LOGO,
+  ECRAN_TITRE,
+  ECRAN_RESET
+};
+
+// Objet. Possede l'ecran OLED et sa tache
+// afficher() doit etre appele par une seule tache : celle du jeu
+template <class Materiel>
+class TacheEcran
+{
+public:
+  TacheEcran();
+
+  void demarrer(uint8_t priorite, uint8_t coeur);
+  void afficher(EcranJeu ecran);
+  uint32_t pagesTransmises() const;
+  const Histogramme &latence() const;
+
+private:
+  using Gpio = typename Materiel::Gpio;
+  using Taches = typename Materiel::Taches;
+  using Horloge = typename Materiel::Horloge;
+
+  // Un _ devant une variable indique que celle-ci est propre a une instance de type TacheEcran
+
+  typename Materiel::Ecran _oled;                       // Ecran OLED. Propre a la tache de l'ecran
+  uint8_t _transmis[SCREEN_WIDTH * PAGES_ECRAN] = {};   // Derniere image transmise. Propre a la tache de l'ecran
+  EcranJeu _courant = ECRAN_VIDE;                       // Ecran dessine. Propre a la tache de l'ecran
+  FileEvenements<EcranJeu, TAILLE_FILE_ECRAN> _demandes; // Du jeu vers la tache de l'ecran
+  typename Taches::Signal _signal;                      // Reveille la tache a chaque demande
+  std::atomic<uint32_t> _pages{0};                      // Nombre de pages transmises depuis le demarrage
+  Histogramme _latence;                                 // Cycles pour dessiner et transmettre un ecran
+
+  static void tache(void *ecran);
+  void executer();
+  void dessiner(EcranJeu ecran);
+  void transmettre();
+  void logo();
+  void titre();
+  void ecranReset();
+};
+
+// Constructeur. L'ecran est cree, mais pas encore demarre. Voir demarrer()
+template <class Materiel>
+TacheEcran<Materiel>::TacheEcran() : _oled(SCREEN_WIDTH, SCREEN_HEIGHT, OLED_RESET)
+{
+}
+
+// Demarre l'ecran avec une image noire, puis la tache qui en devient la seule proprietaire
+template <class Materiel>
+void TacheEcran<Materiel>::demarrer(uint8_t priorite, uint8_t coeur)
+{
+  _oled.begin(SSD1306_SWITCHCAPVCC, SCREEN_ADDRESS);
+  _oled.clearDisplay();
+  _oled.display(); // La memoire de l'ecran est quelconque a l'allumage : la premiere image est complete
+  _pages.fetch_add(PAGES_ECRAN, std::memory_order_relaxed);
+
+  Taches::creer(
+      tache,
+      "ecran",
+      4096,
+      this,
+      priorite,
+      coeur);
+}
+
+// Demande un ecran. Retourne sans attendre le bus I2C
+// Si la tache a pris assez de retard pour remplir la file, la demande est perdue : un ecran plus recent est en attente
+template <class Materiel>
+void TacheEcran<Materiel>::afficher(EcranJeu ecran)
+{
+  _demandes.ajouter(ecran);
+  _signal.signaler();
+}
+
+// Retourne le nombre de pages transmises a l'ecran depuis le demarrage. Peut etre appele de n'importe quelle tache
+template <class Materiel>
+uint32_t TacheEcran<Materiel>::pagesTransmises() const
+{
+  return _pages.load(std::memory_order_relaxed);
+}
+
+// Retourne les cycles pour dessiner un ecran et en transmettre les pages changees. Peut etre lu de n'importe quelle tache
+template <class Materiel>
+const Histogramme &TacheEcran<Materiel>::latence() const
+{
+  return _latence;
+}
+
+// Point d'entree de la tache de l'ecran. 'ecran' est l'instance qui a cree la tache
+template <class Materiel>
+void TacheEcran<Materiel>::tache(void *ecran)
+{
+  static_cast<TacheEcran *>(ecran)->executer();
+}
+
+// Boucle de la tache de l'ecran. Les demandes sont dessinees des leur arrivee, les boutons lus a chaque reveil
+template <class Materiel>
+void TacheEcran<Materiel>::executer()
+{
+  EcranJeu demande;
+
+  while (Taches::actif())
+  {
+    while (_demandes.retirer(demande))
+    {
+      dessiner(demande);
+    }
+
+    if (Gpio::lire(CHANGER) && !Gpio::lire(CONFIRME))
+    {
+      dessiner(ECRAN_LOGO);
+    }
+    else if (!Gpio::lire(CHANGER) && Gpio::lire(CONFIRME))
+    {
+      dessiner(ECRAN_TITRE);
+    }
+
+    _signal.attendre(PERIODE_BOUTONS_MS);
+  }
+}
+
+// Dessine un ecran, sauf s'il est deja affiche, et transmet les pages changees
+template <class Materiel>
+void TacheEcran<Materiel>::dessiner(EcranJeu ecran)
+{
+  uint32_t debut = Horloge::cycles();
+
+  if (ecran == _courant)
+  {
+    return;
+  }
+  _courant = ecran;
+
+  switch (ecran)
+  {
+  case ECRAN_VIDE:
+    _oled.clearDisplay();
+    break;
+  case ECRAN_LOGO:
+    logo();
+    break;
+  case ECRAN_TITRE:
+    titre();
+    break;
+  case ECRAN_RESET:
+    ecranReset();
+    break;
+  }
+  transmettre();
+  _latence.enregistrer(Horloge::cycles() - debut);
+}
+
+// Compare chaque page du tampon avec la derniere image transmise et n'envoie que les pages changees
+template <class Materiel>
+void TacheEcran<Materiel>::transmettre()
+{
+  const uint8_t *tampon = _oled.getBuffer();
+  uint8_t pages = 0; // Bit 'page' actif si la page a change
+
+  for (uint8_t page = 0; page < PAGES_ECRAN; page++)
+  {
+    uint16_t debut = page * SCREEN_WIDTH;
+
+    if (memcmp(tampon + debut, _transmis + debut, SCREEN_WIDTH))
+    {
+      memcpy(_transmis + debut, tampon + debut, SCREEN_WIDTH);
+      pages |= 1 << page;
+    }
+  }
+
+  if (pages)
+  {
+    _oled.afficherPages(pages);
+    _pages.fetch_add(__builtin_popcount(pages), std::memory_order_relaxed);
+  }
+}
+
+// ------------------------------------Fonctions Ecran ---------------------------------------------------------
+
+// Genere le logo sur l'ecran
+template <class Materiel>
+void TacheEcran<Materiel>::logo()
+{
+  _oled.clearDisplay();
+  _oled.drawBitmap(0, 0, epd_bitmap_logo, 128, 64, 1);
+}
+
+// Genere le titre du projet et les auteurs sur l'ecran
+template <class Materiel>
+void TacheEcran<Materiel>::titre()
+{
+  _oled.clearDisplay();              // Efface l'ecran
+  _oled.setTextSize(2);              // Taille du texte
+  _oled.setTextColor(SSD1306_WHITE); // Couleur du texte
+  _oled.setCursor(35, 15);           // Position du curseur
+  _oled.print("Echec");
+  _oled.setCursor(30, 30);
+  _oled.print("Samuel");
+  _oled.setCursor(24, 45);
+  _oled.print("William");
+}
+
+template <class Materiel>
+void TacheEcran<Materiel>::ecranReset()
+{
+  _oled.clearDisplay();
+  _oled.setTextSize(3);
+  _oled.setTextColor(SSD1306_WHITE);
+  _oled.setCursor(30, 15);
+  _oled.print("RESET");
+}
+
+#endif
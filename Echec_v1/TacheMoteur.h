@@ -0,0 +1,148 @@
+/*
+TacheMoteur.h - Tache de l'adversaire : la recherche du Moteur roule hors du jeu, a la plus basse priorite
+Le jeu demande un coup et continue de lire le tableau et le port serie pendant la recherche.
+La tache est sur le coeur de la tache de lecture, a la priorite 0 : le balayage des senseurs passe toujours devant,
+et la recherche n'utilise que le temps ou la tache de lecture dort entre deux balayages.
+Le Moteur cede aussi le processeur tous les NOEUDS_VERIFICATION noeuds aux autres taches de priorite 0.
+*/
+
+#ifndef TacheMoteur_h
+
+#define TacheMoteur_h
+
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+#include <Board.h>
+#include <Moteur.h>
+
+#define BUDGET_MOTEUR_MS 3000 // Temps de recherche par coup, par defaut
+#define VEILLE_MOTEUR_MS 1000 // Attente maximale de la tache sans demande
+
+// Objet. Possede le Moteur et sa tache
+// chercher() et resultat() doivent etre appeles par une seule tache : celle du jeu
+template <class Materiel>
+class TacheMoteur
+{
+public:
+  TacheMoteur();
+
+  void demarrer(uint8_t priorite, uint8_t coeur);
+  void chercher(const Board &plateau, uint32_t budget, uint8_t profondeurMax, const uint64_t *historique, uint8_t positions);
+  bool resultat(ResultatRecherche &resultat);
+  void vider();
+
+private:
+  using Horloge = typename Materiel::Horloge;
+  using Taches = typename Materiel::Taches;
+
+  // Etat de la demande. Le jeu passe de LIBRE a DEMANDEE, la tache de DEMANDEE a FINIE, le jeu de FINIE a LIBRE
+  enum Etat : uint8_t
+  {
+    LIBRE,
+    DEMANDEE,
+    FINIE
+  };
+
+  // Un _ devant une variable indique que celle-ci est propre a une instance de type TacheMoteur
+
+  Moteur _moteur;                   // Recherche et table de transposition. Propre a la tache du moteur
+  Board _position;                  // Position a chercher. Ecrite par le jeu quand l'etat est LIBRE
+  uint32_t _budget = 0;             // Millisecondes permises. Ecrit par le jeu quand l'etat est LIBRE
+  uint8_t _profondeurMax = 0;       // Profondeur permise, 0 sans limite. Idem
+  uint64_t _historique[HISTORIQUE_MAX]; // Cles des positions de la partie avant '_position'. Idem
+  uint8_t _positions = 0;           // Positions dans '_historique'. Idem
+  ResultatRecherche _resultat = {}; // Ecrit par la tache avant de passer a FINIE
+  std::atomic<uint8_t> _etat{LIBRE};
+  std::atomic<bool> _vider{false};  // Le jeu demande d'effacer la table avant la prochaine recherche
+  typename Taches::Signal _signal;  // Reveille la tache a chaque demande
+
+  static void tache(void *moteur);
+  void executer();
+};
+
+// Constructeur. La tache n'est pas encore demarree. Voir demarrer()
+template <class Materiel>
+TacheMoteur<Materiel>::TacheMoteur() : _moteur(Horloge::millis, Taches::ceder)
+{
+}
+
+// Demarre la tache du moteur. Elle dort jusqu'a la premiere demande
+template <class Materiel>
+void TacheMoteur<Materiel>::demarrer(uint8_t priorite, uint8_t coeur)
+{
+  Taches::creer(
+      tache,
+      "moteur",
+      12288, // Une copie du Board par niveau de la recherche, jusqu'a PLY_MAX
+      this,
+      priorite,
+      coeur);
+}
+
+// Demande le meilleur coup du joueur qui a le trait dans 'plateau', en au plus 'budget' millisecondes
+// et 'profondeurMax' demi-coups (voir Moteur::chercher). 'historique' est copie : les repetitions sont des nulles
+// Retourne aussitot. Une seule recherche a la fois : attendre resultat() avant la suivante
+template <class Materiel>
+void TacheMoteur<Materiel>::chercher(const Board &plateau, uint32_t budget, uint8_t profondeurMax, const uint64_t *historique, uint8_t positions)
+{
+  if (_etat.load(std::memory_order_acquire) != LIBRE)
+  {
+    return;
+  }
+  _position = plateau;
+  _budget = budget;
+  _profondeurMax = profondeurMax;
+  _positions = (positions > HISTORIQUE_MAX) ? HISTORIQUE_MAX : positions;
+  memcpy(_historique, historique + positions - _positions, _positions * sizeof(uint64_t));
+  _etat.store(DEMANDEE, std::memory_order_release);
+  _signal.signaler();
+}
+
+// Copie le resultat de la derniere recherche. Faux si elle n'est pas finie
+template <class Materiel>
+bool TacheMoteur<Materiel>::resultat(ResultatRecherche &resultat)
+{
+  if (_etat.load(std::memory_order_acquire) != FINIE)
+  {
+    return false;
+  }
+  resultat = _resultat;
+  _etat.store(LIBRE, std::memory_order_release);
+  return true;
+}
+
+// Efface la table de transposition avant la prochaine recherche. A faire au debut d'une partie
+template <class Materiel>
+void TacheMoteur<Materiel>::vider()
+{
+  _vider.store(true, std::memory_order_relaxed);
+}
+
+// Point d'entree de la tache du moteur. 'moteur' est l'instance qui a cree la tache
+template <class Materiel>
+void TacheMoteur<Materiel>::tache(void *moteur)
+{
+  static_cast<TacheMoteur *>(moteur)->executer();
+}
+
+// Boucle de la tache du moteur : une recherche par demande
+template <class Materiel>
+void TacheMoteur<Materiel>::executer()
+{
+  while (Taches::actif())
+  {
+    if (_etat.load(std::memory_order_acquire) == DEMANDEE)
+    {
+      if (_vider.exchange(false, std::memory_order_relaxed))
+      {
+        _moteur.vider();
+      }
+      _resultat = _moteur.chercher(_position, _budget, _profondeurMax, _historique, _positions);
+      _etat.store(FINIE, std::memory_order_release);
+    }
+    _signal.attendre(VEILLE_MOTEUR_MS);
+  }
+}
+
+#endif
@@ -0,0 +1,229 @@
+/*
+Traces.h - Traces de diagnostic par niveau, gardees en binaire et ecrites plus tard par une tache de basse priorite
+Une trace ne formate rien et n'attend pas le port serie : elle ajoute a un anneau en memoire vive un enregistrement
+binaire (instant, numero du message et deux valeurs). La tache des traces retire les enregistrements et les ecrit
+en texte quand les autres taches dorment. Chaque tache qui trace a sa propre file sans verrou (voir FileEvenements.h).
+Les niveaux au-dessus de NIVEAU_TRACE ne sont pas compiles : leurs macros ne laissent aucune instruction,
+meme pas l'evaluation des arguments. Compiler avec -DNIVEAU_TRACE=NIVEAU_TRACE_DETAIL pour tout voir.
+*/
+
+#ifndef Traces_h
+
+#define Traces_h
+
+#include <stdint.h>
+#include <atomic>
+#include "FileEvenements.h"
+
+#define NIVEAU_TRACE_AUCUN 0  // Aucune trace
+#define NIVEAU_TRACE_ERREUR 1 // Etats inattendus
+#define NIVEAU_TRACE_INFO 2   // Rapports periodiques
+#define NIVEAU_TRACE_DETAIL 3 // Chaque lecture du tableau. Trop frequent pour le port serie sans l'anneau
+
+#ifndef NIVEAU_TRACE
+#define NIVEAU_TRACE NIVEAU_TRACE_INFO // Niveau compile. Les traces plus detaillees disparaissent du code
+#endif
+
+#define TAILLE_FILE_TRACES 64 // Enregistrements en attente par source. Puissance de 2
+#define PERIODE_TRACES_MS 100 // Delai maximal entre deux vidanges de l'anneau
+
+// Tache qui ajoute les traces. Chaque source a sa propre file : un seul producteur par file
+enum SourceTrace : uint8_t
+{
+  SOURCE_LECTURE, // Tache de lecture des senseurs, ou partie demo
+  SOURCE_JEU,     // loop()
+  NOMBRE_SOURCES
+};
+
+// Messages connus. Le texte et le format de chacun sont dans DESCRIPTIONS_TRACES
+enum MessageTrace : uint8_t
+{
+  TRACE_TABLEAU,    // Etat stable publie par la tache de lecture
+  TRACE_VIRTUEL,    // Etat du tableau de la partie demo
+  TRACE_DIFFERENCE, // Cases changees entre deux etats du tableau
+  TRACE_CHANGEES,   // Trop de cases ont change a la fois
+  TRACE_RYTHME,     // Balayages par seconde et publications retardees
+  NOMBRE_MESSAGES
+};
+
+// Format des valeurs d'un message
+enum FormatTrace : uint8_t
+{
+  FORMAT_BINAIRE, // Une valeur de 64 bits, en groupes de 4 bits
+  FORMAT_ENTIERS  // Deux entiers
+};
+
+// Structure. Texte et format d'un message
+struct DescriptionTrace
+{
+  const char *texte;
+  FormatTrace format;
+};
+
+static constexpr DescriptionTrace DESCRIPTIONS_TRACES[NOMBRE_MESSAGES] = {
+    {"Tableau : ", FORMAT_BINAIRE},
+    {"Virtual to bits : ", FORMAT_BINAIRE},
+    {"Difference : ", FORMAT_BINAIRE},
+    {"Cases changees a la fois, attendu : ", FORMAT_ENTIERS},
+    {"Balayages par seconde, publications retardees : ", FORMAT_ENTIERS},
+};
+
+// Structure. Un enregistrement de l'anneau
+struct EnregistrementTrace
+{
+  uint64_t valeurs[2]; // Arguments du message, convertis en texte par la tache des traces seulement
+  uint32_t temps;      // Instant de la trace (micros)
+  MessageTrace message;
+};
+
+// Une macro par niveau. Un niveau non compile ne laisse qu'une expression vide
+#if NIVEAU_TRACE >= NIVEAU_TRACE_ERREUR
+#define TRACE_ERREUR(traces, source, ...) (traces).ajouter(source, __VA_ARGS__)
+#else
+#define TRACE_ERREUR(traces, source, ...) ((void)0)
+#endif
+
+#if NIVEAU_TRACE >= NIVEAU_TRACE_INFO
+#define TRACE_INFO(traces, source, ...) (traces).ajouter(source, __VA_ARGS__)
+#else
+#define TRACE_INFO(traces, source, ...) ((void)0)
+#endif
+
+#if NIVEAU_TRACE >= NIVEAU_TRACE_DETAIL
+#define TRACE_DETAIL(traces, source, ...) (traces).ajouter(source, __VA_ARGS__)
+#else
+#define TRACE_DETAIL(traces, source, ...) ((void)0)
+#endif
+
+// Objet. Anneau des traces et tache qui les ecrit sur le port serie
+// ajouter() ne doit etre appele, pour une source donnee, que par une seule tache
+template <class Materiel>
+class Traces
+{
+public:
+  void demarrer(uint8_t priorite, uint8_t coeur);
+  void ajouter(SourceTrace source, MessageTrace message, uint64_t a = 0, uint64_t b = 0);
+  uint32_t perdues() const;
+
+  static void ecrireBinaire(uint64_t valeur);
+
+private:
+  using Horloge = typename Materiel::Horloge;
+  using Console = typename Materiel::Console;
+  using Taches = typename Materiel::Taches;
+
+  // Un _ devant une variable indique que celle-ci est propre a une instance de type Traces
+
+  FileEvenements<EnregistrementTrace, TAILLE_FILE_TRACES> _files[NOMBRE_SOURCES]; // Une file par source
+  std::atomic<uint32_t> _perdues{0}; // Traces abandonnees parce que leur file etait pleine
+  uint32_t _perduesEcrites = 0;      // Dernier nombre de traces perdues ecrit. Propre a la tache des traces
+
+  static void tache(void *traces);
+  void executer();
+  void ecrire(const EnregistrementTrace &trace);
+};
+
+// Demarre la tache qui vide l'anneau. Elle doit avoir une priorite plus basse que les taches qui tracent
+template <class Materiel>
+void Traces<Materiel>::demarrer(uint8_t priorite, uint8_t coeur)
+{
+  Taches::creer(
+      tache,
+      "traces",
+      4096,
+      this,
+      priorite,
+      coeur);
+}
+
+// Ajoute une trace a la file de 'source'. Ne formate rien et n'attend jamais
+// Une file pleine abandonne la trace : elle est seulement comptee
+template <class Materiel>
+void Traces<Materiel>::ajouter(SourceTrace source, MessageTrace message, uint64_t a, uint64_t b)
+{
+  EnregistrementTrace trace = {{a, b}, Horloge::micros(), message};
+
+  if (!_files[source].ajouter(trace))
+  {
+    _perdues.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+// Retourne le nombre de traces abandonnees depuis le demarrage. Peut etre appele de n'importe quelle tache
+template <class Materiel>
+uint32_t Traces<Materiel>::perdues() const
+{
+  return _perdues.load(std::memory_order_relaxed);
+}
+
+// Ecrit une valeur de 64 bits en binaire, par groupes de 4 bits. L'ESP32 est limite a une impression de 32 bits
+template <class Materiel>
+void Traces<Materiel>::ecrireBinaire(uint64_t valeur)
+{
+  for (int i = 63; i >= 0; i--)
+  {
+    Console::ecrire((valeur & (1ULL << i)) ? '1' : '0');
+    if (i % 4 == 0)
+    {
+      Console::ecrire(" ");
+    }
+  }
+}
+
+// Point d'entree de la tache des traces. 'traces' est l'instance qui a cree la tache
+template <class Materiel>
+void Traces<Materiel>::tache(void *traces)
+{
+  static_cast<Traces *>(traces)->executer();
+}
+
+// Boucle de la tache des traces. Chaque file est videe a son tour, toutes les PERIODE_TRACES_MS
+template <class Materiel>
+void Traces<Materiel>::executer()
+{
+  EnregistrementTrace trace;
+
+  while (Taches::actif())
+  {
+    for (uint8_t source = 0; source < NOMBRE_SOURCES; source++)
+    {
+      while (_files[source].retirer(trace))
+      {
+        ecrire(trace);
+      }
+    }
+
+    if (perdues() != _perduesEcrites)
+    {
+      _perduesEcrites = perdues();
+      Console::ecrire("Traces perdues : ");
+      Console::ecrireLigne(_perduesEcrites);
+    }
+
+    Horloge::attendre(PERIODE_TRACES_MS);
+  }
+}
+
+// Ecrit une trace en texte : instant, message et valeurs
+template <class Materiel>
+void Traces<Materiel>::ecrire(const EnregistrementTrace &trace)
+{
+  const DescriptionTrace &description = DESCRIPTIONS_TRACES[trace.message];
+
+  Console::ecrire(trace.temps);
+  Console::ecrire(' ');
+  Console::ecrire(description.texte);
+  if (description.format == FORMAT_BINAIRE)
+  {
+    ecrireBinaire(trace.valeurs[0]);
+  }
+  else
+  {
+    Console::ecrire((unsigned long)trace.valeurs[0]);
+    Console::ecrire(' ');
+    Console::ecrire((unsigned long)trace.valeurs[1]);
+  }
+  Console::ecrireLigne();
+}
+
+#endif
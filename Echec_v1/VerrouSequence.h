@@ -0,0 +1,94 @@
+/*
+VerrouSequence.h - Dernier etat d'une valeur partagee entre les coeurs, par verrou de sequence (seqlock)
+Un seul ecrivain : il rend la sequence impaire, ecrit la valeur, puis la rend paire.
+Les lecteurs copient la valeur entre deux lectures de la sequence et recommencent si elle a change
+ou si elle etait impaire. Personne ne masque les interruptions et l'ecrivain n'attend jamais un lecteur.
+La valeur est rangee en mots atomiques de 32 bits : un uint64_t n'est pas ecrit d'un seul coup sur l'ESP32.
+*/
+
+#ifndef VerrouSequence_h
+
+#define VerrouSequence_h
+
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+#include <type_traits>
+
+// Objet. Derniere valeur publiee par un ecrivain, lisible sans verrou par plusieurs lecteurs
+template <class T>
+class VerrouSequence
+{
+  static_assert(std::is_trivially_copyable<T>::value, "La valeur doit pouvoir etre copiee octet par octet");
+
+public:
+  void ecrire(const T &valeur);
+  T lire() const;
+  uint32_t reprises() const;
+
+private:
+  static constexpr uint8_t MOTS = (sizeof(T) + 3) / 4;
+
+  // Un _ devant une variable indique que celle-ci est propre a une instance de type VerrouSequence
+
+  std::atomic<uint32_t> _sequence{0};        // Impaire pendant une ecriture
+  std::atomic<uint32_t> _mots[MOTS] = {};    // La valeur, en mots de 32 bits
+  mutable std::atomic<uint32_t> _reprises{0}; // Nombre de lectures recommencees
+};
+
+// Ecrivain. Publie une nouvelle valeur
+template <class T>
+void VerrouSequence<T>::ecrire(const T &valeur)
+{
+  uint32_t mots[MOTS] = {};
+  uint32_t sequence = _sequence.load(std::memory_order_relaxed);
+
+  memcpy(mots, &valeur, sizeof(T));
+
+  _sequence.store(sequence + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  for (uint8_t i = 0; i < MOTS; i++)
+  {
+    _mots[i].store(mots[i], std::memory_order_relaxed);
+  }
+  _sequence.store(sequence + 2, std::memory_order_release);
+}
+
+// Lecteurs. Retourne la derniere valeur publiee. Recommence tant qu'une ecriture est en cours
+template <class T>
+T VerrouSequence<T>::lire() const
+{
+  uint32_t mots[MOTS];
+  T valeur;
+
+  while (true)
+  {
+    uint32_t debut = _sequence.load(std::memory_order_acquire);
+
+    if ((debut & 1) == 0)
+    {
+      for (uint8_t i = 0; i < MOTS; i++)
+      {
+        mots[i] = _mots[i].load(std::memory_order_relaxed);
+      }
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (_sequence.load(std::memory_order_relaxed) == debut)
+      {
+        break;
+      }
+    }
+    _reprises.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  memcpy(&valeur, mots, sizeof(T));
+  return valeur;
+}
+
+// Retourne le nombre de lectures qui ont du recommencer parce que l'ecrivain publiait en meme temps
+template <class T>
+uint32_t VerrouSequence<T>::reprises() const
+{
+  return _reprises.load(std::memory_order_relaxed);
+}
+
+#endif
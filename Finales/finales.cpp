@@ -0,0 +1,484 @@
+/*
+finales.cpp - Generation des tables de finales (bitbases) sur un ordinateur
+Chaque finale est d'abord resolue sur toutes ses positions, sans symetrie : le camp fort (blanc ici) a un roi et une piece,
+le camp faible un roi seul. Le pion avance vers la rangee 7. Les positions gagnees sont trouvees de proche en proche :
+  - un mat, le camp faible au trait, est gagne ;
+  - le camp fort au trait gagne si un de ses coups mene a une position gagnee ;
+  - le camp faible au trait perd si tous ses coups menent a une position gagnee, sans pouvoir prendre la piece.
+On repete jusqu'a ce qu'aucune position ne change. Les autres positions legales sont nulles (pat, piece prise, forteresse).
+La promotion du pion donne une dame : la position suivante est lue dans la table roi et dame, resolue avant.
+Les valeurs sont ensuite rangees par l'index de Case/Finales.cpp (avec les symetries) et compressees par blocs de 64.
+
+Utilisation :
+  finales --sortie Case/FinalesDonnees.h   Genere les tables
+  finales --verifier                       Compare chaque position legale aux tables compilees, et quelques positions connues
+*/
+
+#include <Board.h>
+#include <Fen.h>
+#include <Finales.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#define POSITIONS_COMPLETES (2 * 64 * 64 * 64) // Trait, roi fort, roi faible, piece : sans symetrie
+
+// Structure. Valeurs d'une finale pour toutes ses positions, sans symetrie
+struct Resolution
+{
+  std::vector<uint8_t> legale;
+  std::vector<uint8_t> gagnee;
+};
+
+// Retourne l'index d'une position sans symetrie. trait : 0 si le camp fort a le trait, 1 sinon
+static inline uint32_t complet(int trait, int roiFort, int roiFaible, int piece)
+{
+  return ((trait * 64 + roiFort) * 64 + roiFaible) * 64 + piece;
+}
+
+// Indique si deux cases se touchent (ou sont la meme case)
+static inline bool voisines(int a, int b)
+{
+  return abs(a / 8 - b / 8) <= 1 && abs(a % 8 - b % 8) <= 1;
+}
+
+// Indique si la piece forte en 'piece' attaque 'cible'. Les cases de 'bloqueurs' arretent les lignes de la tour et de la dame
+static bool attaque(TypePiece type, int piece, int cible, uint64_t bloqueurs)
+{
+  int dr = cible / 8 - piece / 8;
+  int dc = cible % 8 - piece % 8;
+
+  if (type == PION)
+  {
+    return dr == 1 && abs(dc) == 1;
+  }
+  if (piece == cible || !((dr == 0 || dc == 0) || (type == REINE && abs(dr) == abs(dc))))
+  {
+    return false;
+  }
+
+  int pasR = (dr > 0) - (dr < 0);
+  int pasC = (dc > 0) - (dc < 0);
+  for (int r = piece / 8 + pasR, c = piece % 8 + pasC; r * 8 + c != cible; r += pasR, c += pasC)
+  {
+    if (bloqueurs & bitCase(r * 8 + c))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Indique si une position est legale : trois cases differentes, rois separes, pion hors des rangees 0 et 7,
+// et roi faible hors d'echec si le camp fort a le trait
+static bool legale(TypePiece type, int trait, int roiFort, int roiFaible, int piece)
+{
+  if (roiFort == piece || roiFaible == piece || voisines(roiFort, roiFaible))
+  {
+    return false;
+  }
+  if (type == PION && (piece / 8 == 0 || piece / 8 == 7))
+  {
+    return false;
+  }
+  return trait == 1 || !attaque(type, piece, roiFaible, bitCase(roiFort));
+}
+
+// Camp fort au trait : vrai si un de ses coups mene a une position gagnee. 'dame' : table roi et dame, pour les promotions
+static bool fortGagne(TypePiece type, const Resolution &resolution, const Resolution *dame, int roiFort, int roiFaible, int piece)
+{
+  // Coups du roi fort
+  for (int arrivee = 0; arrivee < 64; arrivee++)
+  {
+    if (arrivee != roiFort && voisines(arrivee, roiFort) && arrivee != piece && !voisines(arrivee, roiFaible) &&
+        resolution.gagnee[complet(1, arrivee, roiFaible, piece)])
+    {
+      return true;
+    }
+  }
+
+  // Coups du pion : une ou deux cases en avant, promotion en dame sur la rangee 7
+  if (type == PION)
+  {
+    int devant = piece + 8;
+
+    if (devant == roiFort || devant == roiFaible)
+    {
+      return false;
+    }
+    if (devant / 8 == 7)
+    {
+      return dame->gagnee[complet(1, roiFort, roiFaible, devant)];
+    }
+    if (resolution.gagnee[complet(1, roiFort, roiFaible, devant)])
+    {
+      return true;
+    }
+    return piece / 8 == 1 && devant + 8 != roiFort && devant + 8 != roiFaible &&
+           resolution.gagnee[complet(1, roiFort, roiFaible, devant + 8)];
+  }
+
+  // Coups de la tour ou de la dame, arretes par les deux rois
+  for (int arrivee = 0; arrivee < 64; arrivee++)
+  {
+    if (arrivee != roiFort && arrivee != roiFaible && attaque(type, piece, arrivee, bitCase(roiFort) | bitCase(roiFaible)) &&
+        resolution.gagnee[complet(1, roiFort, roiFaible, arrivee)])
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Camp faible au trait : vrai si tous ses coups menent a une position gagnee, ou s'il est mat
+static bool faiblePerd(TypePiece type, const Resolution &resolution, int roiFort, int roiFaible, int piece)
+{
+  int coups = 0;
+
+  for (int arrivee = 0; arrivee < 64; arrivee++)
+  {
+    if (arrivee == roiFaible || !voisines(arrivee, roiFaible) || voisines(arrivee, roiFort))
+    {
+      continue;
+    }
+    // Prendre la piece, que le roi fort ne protege pas, annule la partie
+    if (arrivee == piece)
+    {
+      return false;
+    }
+    // Le roi faible ne bloque pas la ligne qui passe par la case qu'il quitte
+    if (attaque(type, piece, arrivee, bitCase(roiFort)))
+    {
+      continue;
+    }
+    coups++;
+    if (!resolution.gagnee[complet(0, roiFort, arrivee, piece)])
+    {
+      return false;
+    }
+  }
+
+  // Aucun coup : mat si le roi est en echec, sinon pat
+  return coups > 0 || attaque(type, piece, roiFaible, bitCase(roiFort));
+}
+
+// Resout une finale sur toutes ses positions. Retourne le nombre de passes
+static int resoudre(TypePiece type, Resolution &resolution, const Resolution *dame)
+{
+  bool change = true;
+  int passes = 0;
+
+  resolution.legale.assign(POSITIONS_COMPLETES, 0);
+  resolution.gagnee.assign(POSITIONS_COMPLETES, 0);
+  for (int trait = 0; trait < 2; trait++)
+    for (int roiFort = 0; roiFort < 64; roiFort++)
+      for (int roiFaible = 0; roiFaible < 64; roiFaible++)
+        for (int piece = 0; piece < 64; piece++)
+        {
+          resolution.legale[complet(trait, roiFort, roiFaible, piece)] = legale(type, trait, roiFort, roiFaible, piece);
+        }
+
+  while (change)
+  {
+    change = false;
+    passes++;
+    for (int trait = 0; trait < 2; trait++)
+      for (int roiFort = 0; roiFort < 64; roiFort++)
+        for (int roiFaible = 0; roiFaible < 64; roiFaible++)
+          for (int piece = 0; piece < 64; piece++)
+          {
+            uint32_t index = complet(trait, roiFort, roiFaible, piece);
+
+            if (!resolution.legale[index] || resolution.gagnee[index])
+            {
+              continue;
+            }
+            if (trait == 0 ? fortGagne(type, resolution, dame, roiFort, roiFaible, piece)
+                           : faiblePerd(type, resolution, roiFort, roiFaible, piece))
+            {
+              resolution.gagnee[index] = 1;
+              change = true;
+            }
+          }
+  }
+  return passes;
+}
+
+// Structure. Table d'une finale rangee par l'index de Finales.cpp, puis compressee
+struct Compressee
+{
+  uint32_t positions;
+  std::vector<uint8_t> valeurs;   // Valeur de chaque index
+  std::vector<uint8_t> connues;   // L'index a au moins une position legale
+  std::vector<uint32_t> mixtes;
+  std::vector<uint32_t> uniformes;
+  std::vector<uint16_t> rangs;
+  std::vector<uint64_t> blocs;
+};
+
+// Range les positions legales par l'index de Finales.cpp et compresse la table par blocs de 64
+// Retourne faux si deux positions symetriques n'ont pas la meme valeur
+static bool compresser(TypeFinale finale, const Resolution &resolution, Compressee &table)
+{
+  table.positions = (finale == FINALE_KPK) ? 2 * 24 * 64 * 64 : 2 * 10 * 64 * 64;
+  table.valeurs.assign(table.positions, 0);
+  table.connues.assign(table.positions, 0);
+
+  for (int trait = 0; trait < 2; trait++)
+    for (int roiFort = 0; roiFort < 64; roiFort++)
+      for (int roiFaible = 0; roiFaible < 64; roiFaible++)
+        for (int piece = 0; piece < 64; piece++)
+        {
+          uint32_t complete = complet(trait, roiFort, roiFaible, piece);
+          uint32_t index;
+
+          if (!resolution.legale[complete])
+          {
+            continue;
+          }
+          index = indexFinale(finale, trait == 0, roiFort, roiFaible, piece);
+          if (table.connues[index] && table.valeurs[index] != resolution.gagnee[complete])
+          {
+            fprintf(stderr, "%s : symetrie invalide a l'index %u\n", NOMS_FINALES[finale], index);
+            return false;
+          }
+          table.connues[index] = 1;
+          table.valeurs[index] = resolution.gagnee[complete];
+        }
+
+  uint32_t nombreBlocs = table.positions / 64;
+  table.mixtes.assign((nombreBlocs + 31) / 32, 0);
+  table.uniformes.assign((nombreBlocs + 31) / 32, 0);
+  table.rangs.assign((nombreBlocs + 31) / 32, 0);
+  table.blocs.clear();
+
+  for (uint32_t bloc = 0; bloc < nombreBlocs; bloc++)
+  {
+    uint64_t mot = 0;
+    bool gain = false, nulle = false;
+
+    if (bloc % 32 == 0)
+    {
+      table.rangs[bloc / 32] = table.blocs.size();
+    }
+    for (uint32_t i = 0; i < 64; i++)
+    {
+      uint32_t index = bloc * 64 + i;
+
+      if (table.connues[index])
+      {
+        gain |= table.valeurs[index] != 0;
+        nulle |= table.valeurs[index] == 0;
+        mot |= (uint64_t)table.valeurs[index] << i;
+      }
+    }
+    if (gain && nulle)
+    {
+      table.mixtes[bloc / 32] |= 1UL << (bloc % 32);
+      table.blocs.push_back(mot);
+    }
+    else if (gain)
+    {
+      table.uniformes[bloc / 32] |= 1UL << (bloc % 32);
+    }
+  }
+  return true;
+}
+
+// Retourne la taille de la table compressee en octets
+static size_t octets(const Compressee &table)
+{
+  return table.mixtes.size() * 4 + table.uniformes.size() * 4 + table.rangs.size() * 2 + table.blocs.size() * 8;
+}
+
+// Ecrit un tableau de mots en hexadecimal, 8 par ligne
+template <class T>
+static void ecrireTableau(FILE *fichier, const char *type, const char *nom, const char *suffixe, const std::vector<T> &valeurs, int chiffres)
+{
+  fprintf(fichier, "static const %s %s_%s[%zu] PROGMEM = {", type, nom, suffixe, valeurs.empty() ? (size_t)1 : valeurs.size());
+  for (size_t i = 0; i < valeurs.size(); i++)
+  {
+    fprintf(fichier, "%s0x%0*llX%s", (i % 8) ? " " : "\n    ", chiffres, (unsigned long long)valeurs[i], i + 1 < valeurs.size() ? "," : "");
+  }
+  fprintf(fichier, valeurs.empty() ? "0};\n\n" : "};\n\n");
+}
+
+// Ecrit les tables compressees en C++ : des tableaux const, gardes en flash sur l'ESP32
+static bool ecrire(const char *chemin, const Compressee *tables)
+{
+  FILE *fichier = fopen(chemin, "w");
+
+  if (!fichier)
+  {
+    fprintf(stderr, "Ecriture impossible : %s\n", chemin);
+    return false;
+  }
+  fprintf(fichier, "/*\nFinalesDonnees.h - Tables de finales generees par Finales/finales.cpp. Ne pas modifier a la main\n");
+  fprintf(fichier, "Inclus seulement par Finales.cpp. Format des tables : voir Finales.h\n*/\n\n");
+  fprintf(fichier, "#ifndef FinalesDonnees_h\n\n#define FinalesDonnees_h\n\n#include <Finales.h>\n\n");
+  for (int finale = 0; finale < FINALE_AUCUNE; finale++)
+  {
+    const Compressee &table = tables[finale];
+
+    fprintf(fichier, "// %s : %u positions, %zu blocs mixtes, %zu octets\n", NOMS_FINALES[finale], table.positions, table.blocs.size(), octets(table));
+    ecrireTableau(fichier, "uint32_t", NOMS_FINALES[finale], "MIXTES", table.mixtes, 8);
+    ecrireTableau(fichier, "uint32_t", NOMS_FINALES[finale], "UNIFORMES", table.uniformes, 8);
+    ecrireTableau(fichier, "uint16_t", NOMS_FINALES[finale], "RANGS", table.rangs, 4);
+    ecrireTableau(fichier, "uint64_t", NOMS_FINALES[finale], "BLOCS", table.blocs, 16);
+  }
+  fprintf(fichier, "static const TableFinale TABLES_FINALES[FINALE_AUCUNE] = {\n");
+  for (int finale = 0; finale < FINALE_AUCUNE; finale++)
+  {
+    const char *nom = NOMS_FINALES[finale];
+
+    fprintf(fichier, "    {%u, %s_MIXTES, %s_UNIFORMES, %s_RANGS, %s_BLOCS},\n", tables[finale].positions, nom, nom, nom, nom);
+  }
+  fprintf(fichier, "};\n\n#endif\n");
+  fclose(fichier);
+  return true;
+}
+
+// Structure. Une position connue et son resultat
+struct Connue
+{
+  const char *fen;
+  short gagnant; // 1 : blancs, -1 : noirs, 0 : nulle
+};
+
+// Positions dont le resultat est connu, lues en FEN et sondees comme pendant une partie
+static const Connue CONNUES[] = {
+    {"4k3/8/4K3/4P3/8/8/8/8 w - - 0 1", 1},   // Roi sur la sixieme devant son pion : gagne, peu importe le trait
+    {"4k3/8/4K3/4P3/8/8/8/8 b - - 0 1", 1},
+    {"k7/8/1K6/P7/8/8/8/8 w - - 0 1", 0},     // Pion de la colonne a, roi faible dans le coin : nulle
+    {"4k3/8/8/8/8/8/4P3/4K3 w - - 0 1", 1},   // Opposition au trait des blancs apres Kd2, Ke3... : gagne
+    {"4k3/8/8/8/8/8/4P3/4K3 b - - 0 1", 0},   // Les noirs prennent l'opposition : nulle
+    {"8/8/8/8/8/4k3/4p3/4K3 w - - 0 1", 0},   // Pion noir : les blancs sont pat
+    {"8/8/8/8/8/4k3/4p3/4K3 b - - 0 1", -1},  // ...mais les noirs au trait gagnent, par Kd3 Kf2 Kd2
+    {"8/8/8/8/8/8/3r4/3K3k w - - 0 1", 0},    // Tour non protegee prise par le roi blanc
+    {"8/8/8/8/8/8/3r4/3K3k b - - 0 1", -1},
+    {"k7/8/1Q6/8/8/8/8/7K b - - 0 1", 0},     // Pat
+    {"k7/8/1Q6/8/8/8/8/7K w - - 0 1", 1},
+    {"7k/8/8/8/8/8/8/R6K b - - 0 1", 1},      // Tour et roi contre roi : gagne
+};
+
+// Compare chaque position legale aux tables compilees, puis les positions connues. Retourne le nombre d'erreurs
+static int verifier(const Resolution *resolutions)
+{
+  int erreurs = 0;
+
+  for (int finale = 0; finale < FINALE_AUCUNE; finale++)
+  {
+    const Resolution &resolution = resolutions[finale];
+    unsigned long legales[2] = {0, 0}, gagnees[2] = {0, 0}, differentes = 0;
+
+    for (int trait = 0; trait < 2; trait++)
+      for (int roiFort = 0; roiFort < 64; roiFort++)
+        for (int roiFaible = 0; roiFaible < 64; roiFaible++)
+          for (int piece = 0; piece < 64; piece++)
+          {
+            uint32_t complete = complet(trait, roiFort, roiFaible, piece);
+
+            if (!resolution.legale[complete])
+            {
+              continue;
+            }
+            legales[trait]++;
+            gagnees[trait] += resolution.gagnee[complete];
+            differentes += lireFinale((TypeFinale)finale, indexFinale((TypeFinale)finale, trait == 0, roiFort, roiFaible, piece)) !=
+                           (resolution.gagnee[complete] != 0);
+          }
+    printf("%s : fort au trait %lu/%lu gagnees, faible au trait %lu/%lu gagnees, %lu differences\n", NOMS_FINALES[finale],
+           gagnees[0], legales[0], gagnees[1], legales[1], differentes);
+    erreurs += differentes != 0;
+  }
+
+  // Temps d'une consultation, sans la lecture du Board
+  const int repetitions = 20;
+  unsigned long gagnees = 0;
+  auto debut = std::chrono::steady_clock::now();
+  for (int r = 0; r < repetitions; r++)
+  {
+    for (uint32_t index = 0; index < positionsFinale(FINALE_KPK); index++)
+    {
+      gagnees += lireFinale(FINALE_KPK, index);
+    }
+  }
+  double duree = std::chrono::duration<double>(std::chrono::steady_clock::now() - debut).count();
+  printf("Consultation : %.1f ns par position (%lu gagnees)\n", duree * 1e9 / (repetitions * (double)positionsFinale(FINALE_KPK)), gagnees);
+
+  for (const Connue &connue : CONNUES)
+  {
+    Board plateau;
+    short gagnant = 2;
+    TypeFinale finale;
+
+    lireFen(plateau, connue.fen);
+    finale = sonderFinale(plateau, gagnant);
+    if (finale == FINALE_AUCUNE || gagnant != connue.gagnant)
+    {
+      printf("ERREUR : %s donne %d, attendu %d\n", connue.fen, gagnant, connue.gagnant);
+      erreurs++;
+    }
+  }
+  return erreurs;
+}
+
+int main(int argc, char **argv)
+{
+  const char *sortie = nullptr;
+  bool verification = false;
+  const TypePiece pieces[FINALE_AUCUNE] = {PION, TOUR, REINE};
+  const int ordre[FINALE_AUCUNE] = {FINALE_KQK, FINALE_KRK, FINALE_KPK}; // La dame avant le pion, pour les promotions
+  Resolution resolutions[FINALE_AUCUNE];
+  Compressee tables[FINALE_AUCUNE];
+
+  for (int i = 1; i < argc; i++)
+  {
+    if (!strcmp(argv[i], "--sortie") && i + 1 < argc)
+    {
+      sortie = argv[++i];
+    }
+    else if (!strcmp(argv[i], "--verifier"))
+    {
+      verification = true;
+    }
+    else
+    {
+      sortie = nullptr;
+      verification = false;
+      break;
+    }
+  }
+  if (!sortie && !verification)
+  {
+    fprintf(stderr, "Utilisation : %s --sortie FinalesDonnees.h | --verifier\n", argv[0]);
+    return 2;
+  }
+
+  for (int finale : ordre)
+  {
+    auto debut = std::chrono::steady_clock::now();
+    int passes = resoudre(pieces[finale], resolutions[finale], &resolutions[FINALE_KQK]);
+    double duree = std::chrono::duration<double>(std::chrono::steady_clock::now() - debut).count();
+
+    if (!compresser((TypeFinale)finale, resolutions[finale], tables[finale]))
+    {
+      return 1;
+    }
+    printf("%s : %d passes en %.1f s, %zu blocs mixtes sur %u, %zu octets\n", NOMS_FINALES[finale], passes, duree,
+           tables[finale].blocs.size(), tables[finale].positions / 64, octets(tables[finale]));
+  }
+
+  if (sortie)
+  {
+    return ecrire(sortie, tables) ? 0 : 1;
+  }
+  if (verifier(resolutions))
+  {
+    return 1;
+  }
+  printf("Tables a jour\n");
+  return 0;
+}
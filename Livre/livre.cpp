@@ -0,0 +1,346 @@
+/*
+livre.cpp - Generation du livre d'ouvertures sur un ordinateur
+Lit une collection de parties PGN, rejoue les premiers demi-coups de chaque partie sur un Board et compte,
+pour chaque position (cle Zobrist), les parties qui y ont joue chaque coup. Les entrees (cle, coup, poids)
+sont triees par cle et ecrites dans Case/LivreDonnees.h, compile avec la librairie Case.
+La cle Zobrist vient de tables constexpr (Zobrist.h) : elle est la meme sur l'ordinateur et sur l'ESP32.
+Un changement de Zobrist.h ou de l'encodage des coups demande de regenerer le livre (voir --verifier).
+
+Utilisation :
+  livre --pgn Livre/ouvertures.pgn --sortie Case/LivreDonnees.h   Genere le livre
+        [--plies N]                                               Demi-coups retenus au debut de chaque partie (12 par defaut)
+  livre --pgn Livre/ouvertures.pgn --verifier                     Compare le livre compile a celui du PGN,
+                                                                  puis mesure le temps d'une recherche
+*/
+
+#include <Board.h>
+#include <Fen.h>
+#include <Pgn.h>
+#include <Livre.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#define PLIES_LIVRE 12 // Demi-coups retenus au debut de chaque partie, par defaut
+
+// Retire les signes qui ne changent pas le coup : echec, mat et annotations. 0-0 devient O-O
+static std::string nettoyerSan(const char *san)
+{
+  std::string nettoye(san);
+
+  while (!nettoye.empty() && strchr("+#!?", nettoye.back()))
+  {
+    nettoye.pop_back();
+  }
+  for (char &c : nettoye)
+  {
+    if (c == '0')
+    {
+      c = 'O';
+    }
+  }
+  return nettoye;
+}
+
+// Retourne le coup legal dont la notation SAN est 'san', ou COUP_NUL
+// Chaque coup legal est ecrit par ecrireSan et compare : la meme notation que l'export PGN du jeu
+static Coup lireSan(const Board &plateau, const char *san)
+{
+  std::string cherche = nettoyerSan(san);
+  Coup coups[MAX_COUPS];
+  int nombre = plateau.genererCoups(plateau.getTrait(), coups);
+  char ecrit[TAILLE_SAN];
+
+  for (int i = 0; i < nombre; i++)
+  {
+    ecrireSan(plateau, coups[i], ecrit, sizeof(ecrit));
+    if (nettoyerSan(ecrit) == cherche)
+    {
+      return coups[i];
+    }
+  }
+  return COUP_NUL;
+}
+
+// Lit un fichier PGN et ajoute les 'plies' premiers coups de chaque partie a 'poids'
+// Les commentaires ({...} et ;), les variantes (...), les numeros de coups et les NAG ($n) sont ignores
+// Retourne le nombre de parties lues, ou -1 si le fichier est illisible ou contient un coup illegal
+static int lirePgn(const char *chemin, int plies, std::map<std::pair<uint64_t, Coup>, uint32_t> &poids)
+{
+  FILE *fichier = fopen(chemin, "r");
+  std::string texte;
+  char tampon[4096];
+  size_t lu;
+  Board plateau;
+  int ply = 0;
+  int parties = 0;
+  int ligne = 1;
+
+  if (!fichier)
+  {
+    fprintf(stderr, "Fichier illisible : %s\n", chemin);
+    return -1;
+  }
+  while ((lu = fread(tampon, 1, sizeof(tampon), fichier)) > 0)
+  {
+    texte.append(tampon, lu);
+  }
+  fclose(fichier);
+
+  lireFen(plateau, FEN_DEPART);
+  for (size_t i = 0; i < texte.size();)
+  {
+    char c = texte[i];
+
+    if (c == '\n')
+    {
+      ligne++;
+      i++;
+    }
+    else if (c == ' ' || c == '\t' || c == '\r' || c == '.')
+    {
+      i++;
+    }
+    else if (c == '[' || c == ';')
+    {
+      // Etiquette ou commentaire : jusqu'a la fin de la ligne
+      while (i < texte.size() && texte[i] != '\n')
+      {
+        i++;
+      }
+    }
+    else if (c == '{')
+    {
+      while (i < texte.size() && texte[i] != '}')
+      {
+        ligne += texte[i++] == '\n';
+      }
+      i++;
+    }
+    else if (c == '(')
+    {
+      int niveau = 0;
+
+      do
+      {
+        niveau += (texte[i] == '(') - (texte[i] == ')');
+        ligne += texte[i++] == '\n';
+      } while (i < texte.size() && niveau > 0);
+    }
+    else
+    {
+      size_t fin = i;
+
+      while (fin < texte.size() && !strchr(" \t\r\n{(;", texte[fin]))
+      {
+        fin++;
+      }
+      std::string mot = texte.substr(i, fin - i);
+      i = fin;
+
+      // Fin de partie : la prochaine repart de la position de depart
+      if (mot == "1-0" || mot == "0-1" || mot == "1/2-1/2" || mot == "*")
+      {
+        lireFen(plateau, FEN_DEPART);
+        ply = 0;
+        parties++;
+        continue;
+      }
+      // Numero de coup (1. ou 1...), eventuellement colle au coup (1.e4), ou NAG
+      size_t debut = mot.find_first_not_of("0123456789.");
+      if (mot[0] == '$' || debut == std::string::npos)
+      {
+        continue;
+      }
+      mot = mot.substr(debut);
+
+      if (ply >= plies)
+      {
+        continue;
+      }
+      Coup coup = lireSan(plateau, mot.c_str());
+      if (coup == COUP_NUL)
+      {
+        fprintf(stderr, "%s:%d : coup illegal %s\n", chemin, ligne, mot.c_str());
+        return -1;
+      }
+      poids[{plateau.cle(), coup}]++;
+      plateau.jouer(coup);
+      ply++;
+    }
+  }
+  return parties;
+}
+
+// Range les entrees par cle, puis du coup le plus joue au moins joue
+static std::vector<EntreeLivre> trier(const std::map<std::pair<uint64_t, Coup>, uint32_t> &poids)
+{
+  std::vector<EntreeLivre> entrees;
+
+  for (const auto &paire : poids)
+  {
+    uint64_t cle = paire.first.first;
+
+    entrees.push_back({(uint32_t)(cle >> 32), (uint32_t)cle, paire.first.second, (uint16_t)std::min<uint32_t>(paire.second, UINT16_MAX)});
+  }
+  std::sort(entrees.begin(), entrees.end(), [](const EntreeLivre &a, const EntreeLivre &b)
+            {
+              if (a.cleHaute != b.cleHaute)
+              {
+                return a.cleHaute < b.cleHaute;
+              }
+              if (a.cleBasse != b.cleBasse)
+              {
+                return a.cleBasse < b.cleBasse;
+              }
+              return a.poids > b.poids; });
+  return entrees;
+}
+
+// Ecrit le livre en C++ : un tableau const, garde en flash sur l'ESP32
+static bool ecrire(const char *chemin, const char *pgn, int plies, const std::vector<EntreeLivre> &entrees)
+{
+  FILE *fichier = fopen(chemin, "w");
+
+  if (!fichier)
+  {
+    fprintf(stderr, "Ecriture impossible : %s\n", chemin);
+    return false;
+  }
+  fprintf(fichier, "/*\nLivreDonnees.h - Livre d'ouvertures genere par Livre/livre.cpp. Ne pas modifier a la main\n");
+  fprintf(fichier, "Source : %s, %d premiers demi-coups de chaque partie\n", pgn, plies);
+  fprintf(fichier, "Inclus seulement par Livre.cpp. Entrees triees par cle (voir Livre.h)\n*/\n\n");
+  fprintf(fichier, "#ifndef LivreDonnees_h\n\n#define LivreDonnees_h\n\n#include <Livre.h>\n\n");
+  fprintf(fichier, "#define ENTREES_LIVRE %zu\n\n", entrees.size());
+  fprintf(fichier, "static const EntreeLivre LIVRE[ENTREES_LIVRE] PROGMEM = {\n");
+  for (const EntreeLivre &entree : entrees)
+  {
+    fprintf(fichier, "    {0x%08X, 0x%08X, 0x%04X, %u},\n", entree.cleHaute, entree.cleBasse, entree.coup, entree.poids);
+  }
+  fprintf(fichier, "};\n\n#endif\n");
+  fclose(fichier);
+  return true;
+}
+
+// Compare le livre compile avec celui genere du PGN, puis mesure la recherche de chaque position du livre
+static bool verifier(const std::vector<EntreeLivre> &entrees)
+{
+  const int repetitions = 1000;
+  unsigned long trouvees = 0;
+
+  if ((size_t)entreesLivre() != entrees.size())
+  {
+    printf("Livre a regenerer : %d entrees compilees, %zu dans le PGN\n", entreesLivre(), entrees.size());
+    return false;
+  }
+  for (size_t i = 0; i < entrees.size(); i++)
+  {
+    const EntreeLivre &compilee = entreeLivre(i);
+
+    if (compilee.cleHaute != entrees[i].cleHaute || compilee.cleBasse != entrees[i].cleBasse ||
+        compilee.coup != entrees[i].coup || compilee.poids != entrees[i].poids)
+    {
+      printf("Livre a regenerer : entree %zu differente\n", i);
+      return false;
+    }
+  }
+
+  auto debut = std::chrono::steady_clock::now();
+  for (int r = 0; r < repetitions; r++)
+  {
+    for (const EntreeLivre &entree : entrees)
+    {
+      trouvees += chercherLivre(((uint64_t)entree.cleHaute << 32) | entree.cleBasse) >= 0;
+    }
+  }
+  double duree = std::chrono::duration<double>(std::chrono::steady_clock::now() - debut).count();
+
+  printf("Livre a jour : %zu entrees, %zu octets\n", entrees.size(), entrees.size() * sizeof(EntreeLivre));
+  printf("Recherche : %.1f ns par position (%lu trouvees)\n", duree * 1e9 / (repetitions * entrees.size()), trouvees);
+  return trouvees == repetitions * entrees.size();
+}
+
+// Ecrit les coups du livre pour la position de depart, comme un indice au premier coup
+static void afficherDepart()
+{
+  Board plateau;
+  Coup coups[COUPS_LIVRE_MAX];
+  uint16_t poids[COUPS_LIVRE_MAX];
+  char san[TAILLE_SAN];
+  int nombre;
+
+  lireFen(plateau, FEN_DEPART);
+  nombre = coupsLivre(plateau, coups, poids);
+  printf("Depart :");
+  for (int i = 0; i < nombre; i++)
+  {
+    ecrireSan(plateau, coups[i], san, sizeof(san));
+    printf(" %s (%u)", san, poids[i]);
+  }
+  printf("\n");
+}
+
+int main(int argc, char **argv)
+{
+  const char *pgn = nullptr;
+  const char *sortie = nullptr;
+  bool verification = false;
+  int plies = PLIES_LIVRE;
+  std::map<std::pair<uint64_t, Coup>, uint32_t> poids;
+  int parties;
+
+  for (int i = 1; i < argc; i++)
+  {
+    if (!strcmp(argv[i], "--pgn") && i + 1 < argc)
+    {
+      pgn = argv[++i];
+    }
+    else if (!strcmp(argv[i], "--sortie") && i + 1 < argc)
+    {
+      sortie = argv[++i];
+    }
+    else if (!strcmp(argv[i], "--plies") && i + 1 < argc)
+    {
+      plies = atoi(argv[++i]);
+    }
+    else if (!strcmp(argv[i], "--verifier"))
+    {
+      verification = true;
+    }
+    else
+    {
+      pgn = nullptr;
+      break;
+    }
+  }
+  if (!pgn || (!sortie && !verification))
+  {
+    fprintf(stderr, "Utilisation : %s --pgn FICHIER (--sortie LivreDonnees.h [--plies N] | --verifier)\n", argv[0]);
+    return 2;
+  }
+
+  parties = lirePgn(pgn, plies, poids);
+  if (parties < 0)
+  {
+    return 1;
+  }
+  std::vector<EntreeLivre> entrees = trier(poids);
+  printf("%d parties, %zu entrees\n", parties, entrees.size());
+
+  if (sortie)
+  {
+    return ecrire(sortie, pgn, plies, entrees) ? 0 : 1;
+  }
+  if (!verifier(entrees))
+  {
+    return 1;
+  }
+  afficherDepart();
+  return 0;
+}
@@ -0,0 +1,39 @@
+/*
+Materiel.h - Couche d'abstraction du materiel (GPIO, multiplexeurs, DEL, ecran, port serie, horloge, taches et NVS)
+Le code du jeu ne parle jamais directement a Arduino : il recoit une politique 'Materiel' en parametre de gabarit
+et appelle ses types :
+  Materiel::Horloge   micros(), millis(), attendre(ms), attendreMicros(us), attendreJusqua(echeance),
+                      cycles() et cyclesParMicro() : compteur de cycles pour les sondes de latence
+  Materiel::Gpio      configurer(broche, mode), ecrire(broche, niveau), lire(broche),
+                      ecrireMasque(haut, bas) et lireMasque() pour les broches 0 a 31 en un seul acces
+  Materiel::Console   demarrer(baud), ecrire(valeur), ecrireLigne(valeur), lire() : caractere recu ou -1
+  Materiel::Taches    creer(...), coeur(), actif(), ceder(), les types Verrou (entrer(), sortir())
+                      et Signal (signaler(), attendre(ms) : vrai si le signal est arrive)
+  Materiel::Memoire   lire(cle, donnees, taille), ecrire(cle, donnees, taille) : memoire non volatile (NVS)
+  Materiel::Fichiers  ajouter(chemin, donnees, taille), lire(chemin, position, donnees, taille),
+                      taille(chemin), effacer(chemin) : systeme de fichiers en flash (LittleFS)
+  Materiel::Ruban     meme interface que Adafruit_NeoPixel (setPixelColor, show, ...)
+  Materiel::Ecran     meme interface que Adafruit_SSD1306 (clearDisplay, drawBitmap, display, ...),
+                      et afficherPages(pages) : seulement les pages (bandes de 8 rangees) choisies
+Le choix se fait a la compilation : aucune fonction virtuelle, chaque appel est resolu et mis en ligne
+par le compilateur. Sur l'ESP32, Materiel::Gpio::ecrire est exactement digitalWrite.
+
+Deux politiques existent :
+  MaterielEsp32 (MaterielEsp32.h)  le micrologiciel, compile par l'IDE Arduino
+  MaterielHote  (MaterielHote.h)   un ordinateur Linux : matrice d'interrupteurs reed simulee et temps virtuel
+MATERIEL est la politique de la plateforme courante.
+*/
+
+#ifndef Materiel_h
+
+#define Materiel_h
+
+#ifdef ARDUINO
+#include <MaterielEsp32.h>
+#define MATERIEL MaterielEsp32
+#else
+#include <MaterielHote.h>
+#define MATERIEL MaterielHote
+#endif
+
+#endif
@@ -0,0 +1,286 @@
+/*
+MaterielEsp32.h - Politique materielle du micrologiciel (ESP32, IDE Arduino)
+Chaque fonction est un simple relais en ligne vers Arduino ou FreeRTOS : le code genere est le meme
+que si le jeu appelait digitalWrite, delay ou Serial directement.
+Voir Materiel.h pour l'interface commune.
+*/
+
+#ifndef MaterielEsp32_h
+
+#define MaterielEsp32_h
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <Adafruit_GFX.h>
+#include <Adafruit_SSD1306.h>
+#include <Adafruit_NeoPixel.h>
+#include <Preferences.h>
+#include <LittleFS.h>
+#include <soc/gpio_reg.h>
+
+// Horloge. Temps depuis le demarrage de l'ESP32
+struct HorlogeEsp32
+{
+  static uint32_t micros() { return ::micros(); }
+  static uint32_t millis() { return ::millis(); }
+  static void attendre(uint32_t ms) { ::delay(ms); }
+  static void attendreMicros(uint32_t us) { ::delayMicroseconds(us); }
+
+  // Compteur de cycles du coeur courant, pour mesurer les durees courtes (voir Histogramme.h)
+  static uint32_t cycles() { return ESP.getCycleCount(); }
+  static uint32_t cyclesParMicro() { return ::getCpuFrequencyMhz(); }
+
+  // Attend jusqu'a l'instant 'echeance' (voir millis()) en laissant le coeur aux autres taches
+  static void attendreJusqua(uint32_t echeance)
+  {
+    int32_t reste = (int32_t)(echeance - ::millis());
+
+    if (reste > 0)
+    {
+      ::delay(reste);
+    }
+  }
+};
+
+// Broches d'entree et de sortie
+struct GpioEsp32
+{
+  static void configurer(uint8_t broche, uint8_t mode) { ::pinMode(broche, mode); }
+  static void ecrire(uint8_t broche, uint8_t niveau) { ::digitalWrite(broche, niveau); }
+  static int lire(uint8_t broche) { return ::digitalRead(broche); }
+
+  // Ecrit plusieurs broches (0 a 31) directement dans les registres du GPIO, sans lecture-modification-ecriture :
+  // les bits de 'haut' passent a HIGH, puis ceux de 'bas' a LOW. Les autres broches ne changent pas,
+  // meme si l'autre coeur ecrit une broche au meme moment
+  static void ecrireMasque(uint32_t haut, uint32_t bas)
+  {
+    REG_WRITE(GPIO_OUT_W1TS_REG, haut);
+    REG_WRITE(GPIO_OUT_W1TC_REG, bas);
+  }
+
+  // Lit le niveau des broches 0 a 31 en une seule lecture du registre d'entree
+  static uint32_t lireMasque() { return REG_READ(GPIO_IN_REG); }
+};
+
+// Port serie
+struct ConsoleEsp32
+{
+  static void demarrer(unsigned long baud) { Serial.begin(baud); }
+
+  template <class T>
+  static void ecrire(const T &valeur) { Serial.print(valeur); }
+
+  template <class T>
+  static void ecrireLigne(const T &valeur) { Serial.println(valeur); }
+
+  static void ecrireLigne() { Serial.println(); }
+
+  // Prochain caractere recu, ou -1 si aucun n'attend
+  static int lire() { return Serial.read(); }
+};
+
+// Taches FreeRTOS
+struct TachesEsp32
+{
+  // Empeche que deux coeurs accedent a une meme variable en meme temps
+  class Verrou
+  {
+  public:
+    void entrer() { taskENTER_CRITICAL(&_spinlock); }
+    void sortir() { taskEXIT_CRITICAL(&_spinlock); }
+
+  private:
+    portMUX_TYPE _spinlock = portMUX_INITIALIZER_UNLOCKED;
+  };
+
+  // Reveille une tache qui attend. Semaphore binaire de FreeRTOS, sans allocation
+  class Signal
+  {
+  public:
+    Signal() { _semaphore = xSemaphoreCreateBinaryStatic(&_tampon); }
+    Signal(const Signal &) = delete;
+    Signal &operator=(const Signal &) = delete;
+
+    void signaler() { xSemaphoreGive(_semaphore); }
+
+    // Attend un signal pendant au plus 'ms' millisecondes. Faux si aucun signal n'est arrive
+    bool attendre(uint32_t ms) { return xSemaphoreTake(_semaphore, pdMS_TO_TICKS(ms)) == pdTRUE; }
+
+  private:
+    StaticSemaphore_t _tampon;
+    SemaphoreHandle_t _semaphore;
+  };
+
+  // Cree une tache qui roule sur un coeur de l'ESP32
+  static void creer(void (*fonction)(void *), const char *nom, uint32_t pile, void *parametre, uint8_t priorite, uint8_t coeur)
+  {
+    xTaskCreatePinnedToCore(fonction, nom, pile, parametre, priorite, nullptr, coeur);
+  }
+
+  // Coeur sur lequel roule l'appelant
+  static int coeur() { return xPortGetCoreID(); }
+
+  // Les taches du micrologiciel ne s'arretent jamais
+  static constexpr bool actif() { return true; }
+
+  // Laisse rouler les autres taches du meme coeur
+  static void ceder() { taskYIELD(); }
+};
+
+// Memoire non volatile (NVS), dans l'espace de noms "echec". Une cle a au plus 15 caracteres
+struct MemoireEsp32
+{
+  // Copie la valeur de 'cle' dans 'donnees'. Faux si la cle n'existe pas ou n'a pas la taille attendue
+  static bool lire(const char *cle, void *donnees, size_t taille)
+  {
+    Preferences preferences;
+    bool lu;
+
+    preferences.begin("echec", true);
+    lu = preferences.getBytesLength(cle) == taille && preferences.getBytes(cle, donnees, taille) == taille;
+    preferences.end();
+    return lu;
+  }
+
+  // Ecrit 'taille' octets sous 'cle'. Faux si l'ecriture a echoue
+  static bool ecrire(const char *cle, const void *donnees, size_t taille)
+  {
+    Preferences preferences;
+    bool ecrit;
+
+    preferences.begin("echec", false);
+    ecrit = preferences.putBytes(cle, donnees, taille) == taille;
+    preferences.end();
+    return ecrit;
+  }
+};
+
+// Systeme de fichiers LittleFS, sur la partition de donnees de la memoire flash
+// Monte au premier acces et formate s'il est illisible
+struct FichiersEsp32
+{
+  // Ajoute 'taille' octets a la fin du fichier, qui est cree au besoin. Faux si l'ecriture a echoue
+  static bool ajouter(const char *chemin, const void *donnees, size_t taille)
+  {
+    if (!monter())
+    {
+      return false;
+    }
+    File fichier = LittleFS.open(chemin, FILE_APPEND);
+    bool ecrit = fichier && fichier.write(static_cast<const uint8_t *>(donnees), taille) == taille;
+    fichier.close();
+    return ecrit;
+  }
+
+  // Copie au plus 'taille' octets a partir de 'position'. Retourne le nombre d'octets lus
+  static size_t lire(const char *chemin, size_t position, void *donnees, size_t taille)
+  {
+    if (!monter() || !LittleFS.exists(chemin))
+    {
+      return 0;
+    }
+    File fichier = LittleFS.open(chemin, FILE_READ);
+    size_t lu = (fichier && fichier.seek(position)) ? fichier.read(static_cast<uint8_t *>(donnees), taille) : 0;
+    fichier.close();
+    return lu;
+  }
+
+  // Taille du fichier en octets. 0 s'il n'existe pas
+  static size_t taille(const char *chemin)
+  {
+    if (!monter() || !LittleFS.exists(chemin))
+    {
+      return 0;
+    }
+    File fichier = LittleFS.open(chemin, FILE_READ);
+    size_t octets = fichier ? fichier.size() : 0;
+    fichier.close();
+    return octets;
+  }
+
+  // Supprime le fichier. Vrai s'il n'existe plus
+  static bool effacer(const char *chemin)
+  {
+    return monter() && (!LittleFS.exists(chemin) || LittleFS.remove(chemin));
+  }
+
+private:
+  static bool monter()
+  {
+    static bool monte = LittleFS.begin(true);
+    return monte;
+  }
+};
+
+// Ruban de DEL adressables. Le type de DEL (GRB, 800 kHz) est celui du projet
+class RubanEsp32 : public Adafruit_NeoPixel
+{
+public:
+  RubanEsp32(uint16_t nombre, int16_t broche) : Adafruit_NeoPixel(nombre, broche, NEO_GRB + NEO_KHZ800) {}
+};
+
+// Ecran OLED SSD1306 sur le bus I2C
+class EcranEsp32 : public Adafruit_SSD1306
+{
+public:
+  EcranEsp32(uint8_t largeur, uint8_t hauteur, int8_t reset) : Adafruit_SSD1306(largeur, hauteur, &Wire, reset) {}
+
+  // Demarre l'ecran et garde son adresse pour afficherPages()
+  bool begin(uint8_t alimentation, uint8_t adresse)
+  {
+    _adresse = adresse;
+    return Adafruit_SSD1306::begin(alimentation, adresse);
+  }
+
+  // Transmet seulement les pages (bandes de 8 rangees) actives dans 'pages'. display() envoie toujours les 8 pages
+  void afficherPages(uint8_t pages)
+  {
+    const uint8_t *tampon = getBuffer();
+
+    for (uint8_t page = 0; page < height() / 8; page++)
+    {
+      if (!(pages & (1 << page)))
+      {
+        continue;
+      }
+      ssd1306_command(SSD1306_PAGEADDR);
+      ssd1306_command(page);
+      ssd1306_command(page);
+      ssd1306_command(SSD1306_COLUMNADDR);
+      ssd1306_command(0);
+      ssd1306_command(width() - 1);
+
+      Wire.setClock(400000);
+      for (int16_t colonne = 0; colonne < width(); colonne += OCTETS_PAR_ENVOI)
+      {
+        Wire.beginTransmission(_adresse);
+        Wire.write((uint8_t)0x40); // Octet de controle : la suite est de la memoire d'image
+        Wire.write(tampon + page * width() + colonne, OCTETS_PAR_ENVOI);
+        Wire.endTransmission();
+      }
+      Wire.setClock(100000);
+    }
+  }
+
+private:
+  static constexpr uint8_t OCTETS_PAR_ENVOI = 32; // Tient dans le tampon de Wire avec l'octet de controle
+
+  // Un _ devant une variable indique que celle-ci est propre a une instance de type EcranEsp32
+
+  uint8_t _adresse = 0x3C; // Adresse I2C de l'ecran
+};
+
+// Politique materielle du micrologiciel
+struct MaterielEsp32
+{
+  using Horloge = HorlogeEsp32;
+  using Gpio = GpioEsp32;
+  using Console = ConsoleEsp32;
+  using Taches = TachesEsp32;
+  using Memoire = MemoireEsp32;
+  using Fichiers = FichiersEsp32;
+  using Ruban = RubanEsp32;
+  using Ecran = EcranEsp32;
+};
+
+#endif
@@ -0,0 +1,631 @@
+// Politique materielle d'un ordinateur Linux. N'est pas compile pour l'ESP32
+#ifndef ARDUINO
+
+#include <MaterielHote.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+//****** Horloge - Temps virtuel ******//
+
+static const std::chrono::steady_clock::time_point DEBUT = std::chrono::steady_clock::now(); // Demarrage du programme
+static std::atomic<uint32_t> acceleration(1);                                               // Vitesse du temps virtuel par rapport au temps reel
+
+// Retourne le temps virtuel depuis le demarrage en microsecondes
+uint32_t HorlogeHote::micros()
+{
+  auto reel = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - DEBUT);
+
+  return (uint32_t)(reel.count() * acceleration);
+}
+
+// Retourne le temps virtuel depuis le demarrage en millisecondes
+uint32_t HorlogeHote::millis()
+{
+  auto reel = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - DEBUT);
+
+  return (uint32_t)(reel.count() * acceleration / 1000);
+}
+
+// Attend 'ms' millisecondes de temps virtuel
+void HorlogeHote::attendre(uint32_t ms)
+{
+  attendreMicros(ms * 1000);
+}
+
+// Attend 'us' microsecondes de temps virtuel
+// Une attente plus courte qu'une microseconde reelle est active, comme delayMicroseconds() sur l'ESP32 :
+// ceder le processeur a une tache qui boucle coute une tranche de temps entiere
+void HorlogeHote::attendreMicros(uint32_t us)
+{
+  uint32_t reel = us / acceleration;
+
+  if (reel == 0)
+  {
+    auto fin = std::chrono::steady_clock::now() + std::chrono::nanoseconds(us * 1000ULL / acceleration);
+
+    while (std::chrono::steady_clock::now() < fin)
+      ;
+    return;
+  }
+  std::this_thread::sleep_for(std::chrono::microseconds(reel));
+}
+
+// Attend jusqu'a l'instant virtuel 'echeance' (voir millis())
+void HorlogeHote::attendreJusqua(uint32_t echeance)
+{
+  int32_t reste = (int32_t)(echeance - millis());
+
+  if (reste > 0)
+  {
+    attendre(reste);
+  }
+}
+
+// Retourne le temps reel depuis le demarrage en nanosecondes. Joue le role du compteur de cycles de l'ESP32 :
+// les sondes mesurent le travail du processeur, qui n'est pas accelere comme le temps virtuel
+uint32_t HorlogeHote::cycles()
+{
+  return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - DEBUT).count();
+}
+
+// Retourne le nombre d'unites de cycles() par microseconde
+uint32_t HorlogeHote::cyclesParMicro()
+{
+  return 1000;
+}
+
+// Fait avancer le temps virtuel 'facteur' fois plus vite que le temps reel. A appeler avant de creer les taches
+void HorlogeHote::accelerer(uint32_t facteur)
+{
+  acceleration = (facteur < 1) ? 1 : facteur;
+}
+
+//****** Gpio et matrice d'interrupteurs simulee ******//
+
+static std::atomic<uint8_t> niveaux[NOMBRE_BROCHES]; // Niveau de chaque broche, ecrit par le jeu ou force par le simulateur
+static std::atomic<uint64_t> occupationSimulee(0);    // Cases dont l'interrupteur reed est ferme
+static uint8_t brochesSelection[4];                  // S0 a S3 des multiplexeurs
+static uint8_t brochesActivation[4];                 // Activation de chaque multiplexeur. Actif sur un LOW
+static int brocheDonnees = -1;                       // Sortie commune des multiplexeurs. -1 si non branchee
+
+// Le mode d'une broche n'a pas d'effet sur l'ordinateur
+void GpioHote::configurer(uint8_t, uint8_t)
+{
+}
+
+// Ecrit le niveau d'une broche de sortie
+void GpioHote::ecrire(uint8_t broche, uint8_t niveau)
+{
+  if (broche < NOMBRE_BROCHES)
+  {
+    niveaux[broche] = niveau ? HIGH : LOW;
+  }
+}
+
+// Lit le niveau d'une broche
+// La broche de donnees donne l'interrupteur du canal choisi sur le multiplexeur actif, ou LOW si aucun n'est actif
+int GpioHote::lire(uint8_t broche)
+{
+  if (broche >= NOMBRE_BROCHES)
+  {
+    return LOW;
+  }
+  if (broche != brocheDonnees)
+  {
+    return niveaux[broche];
+  }
+
+  int multiplexeur = -1;
+  int canal = 0;
+
+  for (int i = 0; i < 4; i++)
+  {
+    if (niveaux[brochesActivation[i]] == LOW)
+    {
+      if (multiplexeur >= 0)
+      {
+        return LOW; // Deux multiplexeurs actifs en meme temps : leurs sorties se court-circuitent
+      }
+      multiplexeur = i;
+    }
+    canal |= niveaux[brochesSelection[i]] << i;
+  }
+  if (multiplexeur < 0)
+  {
+    return LOW;
+  }
+  return (occupationSimulee >> (63 - (16 * multiplexeur + canal))) & 1;
+}
+
+// Ecrit plusieurs broches (0 a 31) : les bits de 'haut' passent a HIGH, puis ceux de 'bas' a LOW
+void GpioHote::ecrireMasque(uint32_t haut, uint32_t bas)
+{
+  for (uint8_t broche = 0; broche < 32; broche++)
+  {
+    if (haut & (1UL << broche))
+    {
+      niveaux[broche] = HIGH;
+    }
+  }
+  for (uint8_t broche = 0; broche < 32; broche++)
+  {
+    if (bas & (1UL << broche))
+    {
+      niveaux[broche] = LOW;
+    }
+  }
+}
+
+// Lit le niveau des broches 0 a 31, incluant la broche de donnees des multiplexeurs
+uint32_t GpioHote::lireMasque()
+{
+  uint32_t masque = 0;
+
+  for (uint8_t broche = 0; broche < 32; broche++)
+  {
+    masque |= (uint32_t)lire(broche) << broche;
+  }
+  return masque;
+}
+
+// Indique au simulateur les broches des multiplexeurs
+void SimulateurHote::brancherMultiplexeurs(const uint8_t (&selection)[4], const uint8_t (&activation)[4], uint8_t donnees)
+{
+  memcpy(brochesSelection, selection, sizeof(brochesSelection));
+  memcpy(brochesActivation, activation, sizeof(brochesActivation));
+  brocheDonnees = donnees;
+}
+
+// Remplace l'etat de tous les interrupteurs. Le bit (rangee * 8 + colonne) est actif si une piece est sur la case
+void SimulateurHote::setOccupation(uint64_t occupation)
+{
+  occupationSimulee = occupation;
+}
+
+// Retourne l'etat de tous les interrupteurs
+uint64_t SimulateurHote::occupation()
+{
+  return occupationSimulee;
+}
+
+// Pose une piece sur une case
+void SimulateurHote::poser(short position)
+{
+  occupationSimulee |= 1ULL << position;
+}
+
+// Leve la piece d'une case
+void SimulateurHote::lever(short position)
+{
+  occupationSimulee &= ~(1ULL << position);
+}
+
+// Force le niveau d'une broche d'entree. Ex : un bouton appuye
+void SimulateurHote::forcer(uint8_t broche, uint8_t niveau)
+{
+  GpioHote::ecrire(broche, niveau);
+}
+
+//****** Console ******//
+
+// Le port serie est la sortie standard, toujours ouverte
+void ConsoleHote::demarrer(unsigned long)
+{
+}
+
+void ConsoleHote::ecrire(const char *texte)
+{
+  fputs(texte, stdout);
+}
+
+void ConsoleHote::ecrire(char caractere)
+{
+  fputc(caractere, stdout);
+}
+
+void ConsoleHote::ecrire(int valeur)
+{
+  printf("%d", valeur);
+}
+
+void ConsoleHote::ecrire(long valeur)
+{
+  printf("%ld", valeur);
+}
+
+void ConsoleHote::ecrire(unsigned int valeur)
+{
+  printf("%u", valeur);
+}
+
+void ConsoleHote::ecrire(unsigned long valeur)
+{
+  printf("%lu", valeur);
+}
+
+// Deux decimales, comme Serial.print
+void ConsoleHote::ecrire(double valeur)
+{
+  printf("%.2f", valeur);
+}
+
+void ConsoleHote::ecrireLigne()
+{
+  fputc('\n', stdout);
+}
+
+static std::mutex verrouReception; // Le simulateur injecte pendant que le jeu lit
+static std::string reception;      // Caracteres recus, pas encore lus
+
+// Prochain caractere recu, ou -1 si aucun n'attend
+int ConsoleHote::lire()
+{
+  std::lock_guard<std::mutex> garde(verrouReception);
+  int caractere;
+
+  if (reception.empty())
+  {
+    return -1;
+  }
+  caractere = (unsigned char)reception[0];
+  reception.erase(0, 1);
+  return caractere;
+}
+
+// Simulateur. Ajoute du texte aux caracteres recus, comme s'il avait ete tape dans le moniteur serie
+void ConsoleHote::injecter(const char *texte)
+{
+  std::lock_guard<std::mutex> garde(verrouReception);
+
+  reception += texte;
+}
+
+//****** Taches ******//
+
+static std::vector<std::thread> fils;  // Fil d'execution de chaque tache creee
+static std::mutex verrouFils;          // Protege 'fils'
+static std::atomic<bool> enMarche(true); // Faux apres TachesHote::terminer()
+static thread_local int coeurCourant = 1; // Le fil principal joue le role de loop(), sur le coeur 1
+
+// Cree une tache sur son propre fil d'execution. La pile et la priorite sont ignorees
+void TachesHote::creer(void (*fonction)(void *), const char *, uint32_t, void *parametre, uint8_t, uint8_t coeur)
+{
+  std::lock_guard<std::mutex> garde(verrouFils);
+
+  fils.emplace_back([fonction, parametre, coeur]()
+                    {
+                      coeurCourant = coeur;
+                      fonction(parametre); });
+}
+
+// Retourne le coeur donne a la creation de la tache courante
+int TachesHote::coeur()
+{
+  return coeurCourant;
+}
+
+// Retourne faux quand les taches doivent se terminer
+bool TachesHote::actif()
+{
+  return enMarche;
+}
+
+void TachesHote::ceder()
+{
+  std::this_thread::yield();
+}
+
+// Demande aux taches de se terminer et attend leur fin
+// Chaque tache doit verifier actif() dans sa boucle
+void TachesHote::terminer()
+{
+  std::lock_guard<std::mutex> garde(verrouFils);
+
+  enMarche = false;
+  for (std::thread &fil : fils)
+  {
+    fil.join();
+  }
+  fils.clear();
+}
+
+// Donne le signal et reveille la tache qui attend
+void TachesHote::Signal::signaler()
+{
+  {
+    std::lock_guard<std::mutex> garde(_mutex);
+    _donne = true;
+  }
+  _condition.notify_one();
+}
+
+// Attend un signal pendant au plus 'ms' millisecondes virtuelles. Faux si aucun signal n'est arrive
+bool TachesHote::Signal::attendre(uint32_t ms)
+{
+  std::unique_lock<std::mutex> garde(_mutex);
+  bool donne = _condition.wait_for(garde, std::chrono::microseconds(ms * 1000ULL / acceleration), [this] { return _donne; });
+
+  _donne = false;
+  return donne;
+}
+
+//****** Memoire non volatile ******//
+
+static std::mutex verrouMemoire;                              // Les taches peuvent lire et ecrire en meme temps
+static std::map<std::string, std::vector<uint8_t>> memoire;  // Valeur de chaque cle
+
+// Copie la valeur de 'cle' dans 'donnees'. Faux si la cle n'existe pas ou n'a pas la taille attendue
+bool MemoireHote::lire(const char *cle, void *donnees, size_t taille)
+{
+  std::lock_guard<std::mutex> garde(verrouMemoire);
+  auto valeur = memoire.find(cle);
+
+  if (valeur == memoire.end() || valeur->second.size() != taille)
+  {
+    return false;
+  }
+  memcpy(donnees, valeur->second.data(), taille);
+  return true;
+}
+
+// Ecrit 'taille' octets sous 'cle'
+bool MemoireHote::ecrire(const char *cle, const void *donnees, size_t taille)
+{
+  std::lock_guard<std::mutex> garde(verrouMemoire);
+  const uint8_t *octets = static_cast<const uint8_t *>(donnees);
+
+  memoire[cle].assign(octets, octets + taille);
+  return true;
+}
+
+// Efface toutes les cles, comme une NVS neuve
+void MemoireHote::effacer()
+{
+  std::lock_guard<std::mutex> garde(verrouMemoire);
+
+  memoire.clear();
+}
+
+//****** Systeme de fichiers ******//
+
+static std::mutex verrouFichiers;                              // Les taches peuvent lire et ecrire en meme temps
+static std::map<std::string, std::vector<uint8_t>> fichiers;   // Contenu de chaque fichier
+
+// Ajoute 'taille' octets a la fin du fichier, qui est cree au besoin
+bool FichiersHote::ajouter(const char *chemin, const void *donnees, size_t taille)
+{
+  std::lock_guard<std::mutex> garde(verrouFichiers);
+  const uint8_t *octets = static_cast<const uint8_t *>(donnees);
+  std::vector<uint8_t> &fichier = fichiers[chemin];
+
+  fichier.insert(fichier.end(), octets, octets + taille);
+  return true;
+}
+
+// Copie au plus 'taille' octets a partir de 'position'. Retourne le nombre d'octets lus
+size_t FichiersHote::lire(const char *chemin, size_t position, void *donnees, size_t taille)
+{
+  std::lock_guard<std::mutex> garde(verrouFichiers);
+  auto fichier = fichiers.find(chemin);
+
+  if (fichier == fichiers.end() || position >= fichier->second.size())
+  {
+    return 0;
+  }
+  taille = std::min(taille, fichier->second.size() - position);
+  memcpy(donnees, fichier->second.data() + position, taille);
+  return taille;
+}
+
+// Taille du fichier en octets. 0 s'il n'existe pas
+size_t FichiersHote::taille(const char *chemin)
+{
+  std::lock_guard<std::mutex> garde(verrouFichiers);
+  auto fichier = fichiers.find(chemin);
+
+  return (fichier == fichiers.end()) ? 0 : fichier->second.size();
+}
+
+// Supprime le fichier
+bool FichiersHote::effacer(const char *chemin)
+{
+  std::lock_guard<std::mutex> garde(verrouFichiers);
+
+  fichiers.erase(chemin);
+  return true;
+}
+
+//****** Ruban de DEL ******//
+
+#define MICROS_PAR_DEL 30 // 24 bits a 800 kHz
+
+RubanHote::RubanHote(uint16_t nombre, int16_t)
+{
+  _nombre = (nombre > 256) ? 256 : nombre;
+  _transmissions = 0;
+  clear();
+  memset(_affiches, 0, sizeof(_affiches));
+}
+
+void RubanHote::begin()
+{
+}
+
+// Transmet les couleurs au ruban. Prend le meme temps virtuel que sur l'ESP32
+void RubanHote::show()
+{
+  memcpy(_affiches, _pixels, sizeof(_pixels));
+  _transmissions++;
+  HorlogeHote::attendreMicros(_nombre * MICROS_PAR_DEL);
+}
+
+void RubanHote::clear()
+{
+  memset(_pixels, 0, sizeof(_pixels));
+}
+
+// La luminosite n'est pas simulee
+void RubanHote::setBrightness(uint8_t)
+{
+}
+
+void RubanHote::setPixelColor(uint16_t position, uint32_t couleur)
+{
+  if (position < _nombre)
+  {
+    _pixels[position] = couleur;
+  }
+}
+
+uint32_t RubanHote::getPixelColor(uint16_t position) const
+{
+  return (position < _nombre) ? _pixels[position] : 0;
+}
+
+uint16_t RubanHote::numPixels() const
+{
+  return _nombre;
+}
+
+// Couleur sur 32 bits, meme format que Adafruit_NeoPixel::Color
+uint32_t RubanHote::Color(uint8_t rouge, uint8_t vert, uint8_t bleu)
+{
+  return ((uint32_t)rouge << 16) | ((uint32_t)vert << 8) | bleu;
+}
+
+// Retourne la couleur d'une DEL lors de la derniere transmission
+uint32_t RubanHote::affiche(uint16_t position) const
+{
+  return (position < _nombre) ? _affiches[position] : 0;
+}
+
+// Retourne le nombre de transmissions depuis la creation
+unsigned long RubanHote::transmissions() const
+{
+  return _transmissions;
+}
+
+//****** Ecran OLED ******//
+
+#define MICROS_PAR_OCTET_I2C 23 // 9 bits (8 bits et un acquittement) a 400 kHz
+
+EcranHote::EcranHote(uint8_t largeur, uint8_t hauteur, int8_t)
+{
+  _largeur = (largeur > 128) ? 128 : largeur;
+  _hauteur = (hauteur > 64) ? 64 : hauteur;
+  _transmissions = 0;
+  _pages = 0;
+  _texte[0] = '\0';
+  clearDisplay();
+}
+
+bool EcranHote::begin(uint8_t, uint8_t)
+{
+  return true;
+}
+
+// Transmet le tampon complet. Prend le meme temps virtuel que le bus I2C de l'ESP32
+void EcranHote::display()
+{
+  _transmissions++;
+  _pages += _hauteur / 8;
+  HorlogeHote::attendreMicros(_largeur * _hauteur / 8 * MICROS_PAR_OCTET_I2C);
+}
+
+// Transmet seulement les pages (bandes de 8 rangees) actives dans 'pages'
+void EcranHote::afficherPages(uint8_t pages)
+{
+  uint8_t nombre = __builtin_popcount(pages & ((1 << (_hauteur / 8)) - 1));
+
+  _transmissions++;
+  _pages += nombre;
+  HorlogeHote::attendreMicros(_largeur * nombre * MICROS_PAR_OCTET_I2C);
+}
+
+void EcranHote::clearDisplay()
+{
+  memset(_tampon, 0, sizeof(_tampon));
+}
+
+void EcranHote::drawPixel(int16_t x, int16_t y, uint16_t couleur)
+{
+  if (x < 0 || y < 0 || x >= _largeur || y >= _hauteur)
+  {
+    return;
+  }
+  if (couleur)
+  {
+    _tampon[x + (y / 8) * _largeur] |= 1 << (y % 8);
+  }
+  else
+  {
+    _tampon[x + (y / 8) * _largeur] &= ~(1 << (y % 8));
+  }
+}
+
+// Dessine une image d'un bit par pixel, rangee par rangee, le bit de poids fort a gauche. Les bits a 0 sont transparents
+void EcranHote::drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t largeur, int16_t hauteur, uint16_t couleur)
+{
+  int16_t octetsRangee = (largeur + 7) / 8;
+
+  for (int16_t j = 0; j < hauteur; j++)
+  {
+    for (int16_t i = 0; i < largeur; i++)
+    {
+      if (bitmap[j * octetsRangee + i / 8] & (0x80 >> (i % 8)))
+      {
+        drawPixel(x + i, y + j, couleur);
+      }
+    }
+  }
+}
+
+void EcranHote::setTextSize(uint8_t)
+{
+}
+
+void EcranHote::setTextColor(uint16_t)
+{
+}
+
+void EcranHote::setCursor(int16_t, int16_t)
+{
+}
+
+void EcranHote::print(const char *texte)
+{
+  strncpy(_texte, texte, sizeof(_texte) - 1);
+  _texte[sizeof(_texte) - 1] = '\0';
+}
+
+uint8_t *EcranHote::getBuffer()
+{
+  return _tampon;
+}
+
+// Retourne le dernier texte ecrit a l'ecran
+const char *EcranHote::texte() const
+{
+  return _texte;
+}
+
+// Retourne le nombre de transmissions depuis la creation
+unsigned long EcranHote::transmissions() const
+{
+  return _transmissions;
+}
+
+// Retourne le nombre de pages transmises depuis la creation
+unsigned long EcranHote::pages() const
+{
+  return _pages;
+}
+
+#endif
@@ -0,0 +1,231 @@
+/*
+MaterielHote.h - Politique materielle d'un ordinateur Linux
+Permet de compiler et de rouler le jeu comme un programme ordinaire, avec les sanitizers et perf.
+  - Horloge : temps virtuel. Le temps du jeu avance 'acceleration' fois plus vite que le temps reel,
+    ce qui garde l'ordre des evenements entre les taches tout en raccourcissant les attentes
+  - Gpio : niveaux des broches en memoire. La broche de donnees des multiplexeurs lit une matrice
+    d'interrupteurs reed simulee (voir SimulateurHote), les autres entrees (boutons) sont forcees par le simulateur
+  - Console : sortie standard
+  - Taches : fils d'execution (std::thread), arretes par TachesHote::terminer()
+  - Memoire : NVS en memoire, videe a chaque lancement du programme
+  - Fichiers : systeme de fichiers en memoire, vide a chaque lancement du programme
+  - Ruban et Ecran : tampons en memoire, avec le temps de transmission du vrai materiel
+Voir Materiel.h pour l'interface commune.
+*/
+
+#ifndef MaterielHote_h
+
+#define MaterielHote_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include <condition_variable>
+#include <mutex>
+
+// Constantes d'Arduino utilisees par le jeu
+#define LOW 0x0
+#define HIGH 0x1
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define bitRead(valeur, bit) (((valeur) >> (bit)) & 0x01)
+#define PROGMEM
+
+// Constantes d'Adafruit_SSD1306 utilisees par le jeu
+#define SSD1306_BLACK 0
+#define SSD1306_WHITE 1
+#define SSD1306_SWITCHCAPVCC 0x02
+
+#define NOMBRE_BROCHES 40 // GPIO 0 a 39 de l'ESP32
+
+// Horloge virtuelle
+struct HorlogeHote
+{
+  static uint32_t micros();
+  static uint32_t millis();
+  static void attendre(uint32_t ms);
+  static void attendreMicros(uint32_t us);
+  static void attendreJusqua(uint32_t echeance);
+  static uint32_t cycles();
+  static uint32_t cyclesParMicro();
+
+  static void accelerer(uint32_t acceleration);
+};
+
+// Broches d'entree et de sortie
+struct GpioHote
+{
+  static void configurer(uint8_t broche, uint8_t mode);
+  static void ecrire(uint8_t broche, uint8_t niveau);
+  static int lire(uint8_t broche);
+  static void ecrireMasque(uint32_t haut, uint32_t bas);
+  static uint32_t lireMasque();
+};
+
+// Port serie, ecrit sur la sortie standard. Les caracteres recus sont injectes par le simulateur
+struct ConsoleHote
+{
+  static void demarrer(unsigned long baud);
+
+  static void ecrire(const char *texte);
+  static void ecrire(char caractere);
+  static void ecrire(int valeur);
+  static void ecrire(long valeur);
+  static void ecrire(unsigned int valeur);
+  static void ecrire(unsigned long valeur);
+  static void ecrire(double valeur);
+
+  template <class T>
+  static void ecrireLigne(const T &valeur)
+  {
+    ecrire(valeur);
+    ecrireLigne();
+  }
+
+  static void ecrireLigne();
+
+  static int lire();
+  static void injecter(const char *texte);
+};
+
+// Taches, chacune sur son propre fil d'execution
+struct TachesHote
+{
+  // Section critique entre les taches
+  class Verrou
+  {
+  public:
+    void entrer() { _mutex.lock(); }
+    void sortir() { _mutex.unlock(); }
+
+  private:
+    std::mutex _mutex;
+  };
+
+  // Reveille une tache qui attend. Un signal donne avant l'attente n'est pas perdu
+  class Signal
+  {
+  public:
+    void signaler();
+    bool attendre(uint32_t ms);
+
+  private:
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    bool _donne = false;
+  };
+
+  static void creer(void (*fonction)(void *), const char *nom, uint32_t pile, void *parametre, uint8_t priorite, uint8_t coeur);
+  static int coeur();
+  static bool actif();
+  static void ceder();
+
+  static void terminer();
+};
+
+// Memoire non volatile. Les cles et leurs valeurs sont gardees en memoire
+struct MemoireHote
+{
+  static bool lire(const char *cle, void *donnees, size_t taille);
+  static bool ecrire(const char *cle, const void *donnees, size_t taille);
+
+  static void effacer();
+};
+
+// Systeme de fichiers. Les fichiers sont gardes en memoire
+struct FichiersHote
+{
+  static bool ajouter(const char *chemin, const void *donnees, size_t taille);
+  static size_t lire(const char *chemin, size_t position, void *donnees, size_t taille);
+  static size_t taille(const char *chemin);
+  static bool effacer(const char *chemin);
+};
+
+// Ruban de DEL adressables. Les couleurs sont gardees en memoire
+class RubanHote
+{
+public:
+  RubanHote(uint16_t nombre, int16_t broche);
+
+  void begin();
+  void show();
+  void clear();
+  void setBrightness(uint8_t luminosite);
+  void setPixelColor(uint16_t position, uint32_t couleur);
+  uint32_t getPixelColor(uint16_t position) const;
+  uint16_t numPixels() const;
+  static uint32_t Color(uint8_t rouge, uint8_t vert, uint8_t bleu);
+
+  uint32_t affiche(uint16_t position) const;
+  unsigned long transmissions() const;
+
+private:
+  // Un _ devant une variable indique que celle-ci est propre a une instance de type RubanHote
+
+  uint16_t _nombre;             // Nombre de DEL
+  uint32_t _pixels[256];        // Couleurs en attente de transmission
+  uint32_t _affiches[256];      // Couleurs lors de la derniere transmission
+  unsigned long _transmissions; // Nombre d'appels a show()
+};
+
+// Ecran OLED monochrome. Le tampon a le meme format que celui d'Adafruit_SSD1306 : 8 pages de 128 octets
+// Le texte n'est pas dessine dans le tampon, seul le dernier texte ecrit est garde
+class EcranHote
+{
+public:
+  EcranHote(uint8_t largeur, uint8_t hauteur, int8_t reset);
+
+  bool begin(uint8_t alimentation, uint8_t adresse);
+  void display();
+  void afficherPages(uint8_t pages);
+  void clearDisplay();
+  void drawPixel(int16_t x, int16_t y, uint16_t couleur);
+  void drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t largeur, int16_t hauteur, uint16_t couleur);
+  void setTextSize(uint8_t taille);
+  void setTextColor(uint16_t couleur);
+  void setCursor(int16_t x, int16_t y);
+  void print(const char *texte);
+  uint8_t *getBuffer();
+
+  const char *texte() const;
+  unsigned long transmissions() const;
+  unsigned long pages() const;
+
+private:
+  // Un _ devant une variable indique que celle-ci est propre a une instance de type EcranHote
+
+  uint8_t _largeur;
+  uint8_t _hauteur;
+  uint8_t _tampon[128 * 64 / 8]; // Un bit par pixel, par pages de 8 rangees
+  char _texte[32];               // Dernier texte ecrit
+  unsigned long _transmissions;  // Nombre d'appels a display() et afficherPages()
+  unsigned long _pages;          // Nombre de pages transmises
+};
+
+// Matrice d'interrupteurs reed et boutons simules
+// Cablage : le canal 'c' du multiplexeur 'm' lit l'interrupteur de la case 63 - (16 * m + c)
+struct SimulateurHote
+{
+  static void brancherMultiplexeurs(const uint8_t (&selection)[4], const uint8_t (&activation)[4], uint8_t donnees);
+
+  static void setOccupation(uint64_t occupation);
+  static uint64_t occupation();
+  static void poser(short position);
+  static void lever(short position);
+
+  static void forcer(uint8_t broche, uint8_t niveau);
+};
+
+// Politique materielle d'un ordinateur Linux
+struct MaterielHote
+{
+  using Horloge = HorlogeHote;
+  using Gpio = GpioHote;
+  using Console = ConsoleHote;
+  using Taches = TachesHote;
+  using Memoire = MemoireHote;
+  using Fichiers = FichiersHote;
+  using Ruban = RubanHote;
+  using Ecran = EcranHote;
+};
+
+#endif
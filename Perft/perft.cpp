@@ -0,0 +1,282 @@
+/*
+perft.cpp - Validation et mesure du generateur de coups sur un ordinateur
+Compte les feuilles de l'arbre des coups legaux jusqu'a une profondeur donnee (perft)
+et compare le resultat aux valeurs publiees pour des positions de reference.
+Chaque optimisation du generateur doit garder les memes comptes, et le nombre de noeuds
+par seconde mesure son gain.
+
+Utilisation :
+  perft                          Suite de reference complete
+  perft --fen "<FEN>" --depth N  Compte une position jusqu'a la profondeur N
+  perft --fen "<FEN>" --depth N --divide
+                                 Compte chaque coup de la racine separement, pour trouver une difference
+                                 avec un autre programme
+  perft --suite --max N          Suite de reference, limitee a N noeuds par position
+*/
+
+#include <Board.h>
+#include <Fen.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// Structure. Une position de reference et ses comptes publies, de la profondeur 1 a 6 (0 si non utilise)
+struct Reference
+{
+  const char *nom;
+  const char *fen;
+  unsigned long long noeuds[6];
+};
+
+// Positions de reference (chessprogramming.org, "Perft Results")
+static const Reference SUITE[] = {
+    {"Depart", FEN_DEPART,
+     {20ULL, 400ULL, 8902ULL, 197281ULL, 4865609ULL, 0}},
+    {"Kiwipete", "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+     {48ULL, 2039ULL, 97862ULL, 4085603ULL, 0, 0}},
+    {"Position 3", "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+     {14ULL, 191ULL, 2812ULL, 43238ULL, 674624ULL, 11030083ULL}},
+    {"Position 4", "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+     {6ULL, 264ULL, 9467ULL, 422333ULL, 15833292ULL, 0}},
+    {"Position 4 miroir", "r2q1rk1/pP1p2pp/Q4n2/bbp1p3/Np6/1B3NBn/pPPP1PPP/R3K2R b KQ - 0 1",
+     {6ULL, 264ULL, 9467ULL, 422333ULL, 15833292ULL, 0}},
+    {"Position 5", "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+     {44ULL, 1486ULL, 62379ULL, 2103487ULL, 0, 0}},
+    {"Position 6", "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10",
+     {46ULL, 2079ULL, 89890ULL, 3894594ULL, 0, 0}},
+};
+
+// Compte les feuilles de l'arbre des coups legaux a 'profondeur'
+// Copier-jouer : chaque coup est joue sur une copie du Board, il n'y a rien a defaire
+// A la profondeur 1, le nombre de coups generes est le nombre de feuilles
+static unsigned long long perft(const Board &plateau, int profondeur)
+{
+  Coup coups[MAX_COUPS];
+  int nombre;
+  unsigned long long total = 0;
+
+  if (profondeur < 1)
+  {
+    return 1;
+  }
+
+  nombre = plateau.genererCoups(plateau.getTrait(), coups);
+  if (profondeur == 1)
+  {
+    return nombre;
+  }
+
+  for (int i = 0; i < nombre; i++)
+  {
+    Board copie = plateau;
+
+    copie.jouer(coups[i]);
+    total += perft(copie, profondeur - 1);
+  }
+  return total;
+}
+
+// Ecrit un coup en notation FEN. Ex : e2e4, e7e8q
+static void nomCoup(Coup coup, char nom[6])
+{
+  const char promotions[] = {'n', 'b', 'r', 'q'};
+  short depart = departCoup(coup);
+  short arrivee = arriveeCoup(coup);
+
+  nom[0] = lettreFen(depart % TAILLE);
+  nom[1] = '1' + depart / TAILLE;
+  nom[2] = lettreFen(arrivee % TAILLE);
+  nom[3] = '1' + arrivee / TAILLE;
+  nom[4] = estPromotion(coup) ? promotions[promotionCoup(coup) - CAVALIER] : '\0';
+  nom[5] = '\0';
+}
+
+// Retourne le temps ecoule depuis 'debut' en secondes
+static double secondes(std::chrono::steady_clock::time_point debut)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - debut).count();
+}
+
+// Affiche le compte de chaque coup de la racine, puis le total
+static unsigned long long diviser(const Board &plateau, int profondeur)
+{
+  Coup coups[MAX_COUPS];
+  int nombre = plateau.genererCoups(plateau.getTrait(), coups);
+  unsigned long long total = 0;
+  char nom[6];
+
+  for (int i = 0; i < nombre; i++)
+  {
+    Board copie = plateau;
+    unsigned long long noeuds;
+
+    copie.jouer(coups[i]);
+    noeuds = perft(copie, profondeur - 1);
+    total += noeuds;
+    nomCoup(coups[i], nom);
+    printf("%s: %llu\n", nom, noeuds);
+  }
+  printf("\nCoups : %d\nNoeuds : %llu\n", nombre, total);
+  return total;
+}
+
+// Compte une position a chaque profondeur de 1 a 'profondeur' et affiche le temps et les noeuds par seconde
+// attendus : comptes publies (ou nullptr). Retourne false si un compte differe
+static bool mesurer(const Board &plateau, int profondeur, const unsigned long long *attendus, unsigned long long maximum)
+{
+  bool valide = true;
+
+  for (int p = 1; p <= profondeur; p++)
+  {
+    unsigned long long attendu = attendus ? attendus[p - 1] : 0;
+
+    if (attendus && (attendu == 0 || attendu > maximum))
+    {
+      break;
+    }
+
+    auto debut = std::chrono::steady_clock::now();
+    unsigned long long noeuds = perft(plateau, p);
+    double duree = secondes(debut);
+
+    printf("  profondeur %d : %12llu noeuds %9.3f s %10.0f noeuds/s", p, noeuds, duree, duree > 0 ? noeuds / duree : 0.0);
+    if (attendus)
+    {
+      printf("  %s", noeuds == attendu ? "OK" : "ERREUR");
+      if (noeuds != attendu)
+      {
+        printf(" (attendu %llu)", attendu);
+        valide = false;
+      }
+    }
+    printf("\n");
+  }
+  return valide;
+}
+
+// Verifie que la position relue en FEN redonne la chaine d'origine, sans les compteurs de coups
+static bool memeFen(const Board &plateau, const char *fen)
+{
+  char relue[TAILLE_FEN];
+  int longueur = 0;
+  int espaces = 0;
+
+  ecrireFen(plateau, relue, sizeof(relue));
+  while (fen[longueur] && espaces < 4)
+  {
+    espaces += fen[longueur++] == ' ';
+  }
+  if (strncmp(relue, fen, longueur))
+  {
+    printf("  FEN relue differente : %s\n", relue);
+    return false;
+  }
+  return true;
+}
+
+// Roule la suite de reference. Retourne le nombre de positions en erreur
+static int suite(unsigned long long maximum)
+{
+  int erreurs = 0;
+  unsigned long long total = 0;
+  auto debut = std::chrono::steady_clock::now();
+
+  for (const Reference &reference : SUITE)
+  {
+    Board plateau;
+
+    printf("%s : %s\n", reference.nom, reference.fen);
+    if (!lireFen(plateau, reference.fen))
+    {
+      printf("  FEN invalide\n");
+      erreurs++;
+      continue;
+    }
+    if (!memeFen(plateau, reference.fen))
+    {
+      erreurs++;
+    }
+    if (!mesurer(plateau, 6, reference.noeuds, maximum))
+    {
+      erreurs++;
+    }
+    for (int p = 0; p < 6; p++)
+    {
+      if (reference.noeuds[p] && reference.noeuds[p] <= maximum)
+      {
+        total += reference.noeuds[p];
+      }
+    }
+  }
+
+  double duree = secondes(debut);
+  printf("\nTotal : %llu noeuds en %.3f s (%.0f noeuds/s), %d position(s) en erreur\n", total, duree, duree > 0 ? total / duree : 0.0, erreurs);
+  return erreurs;
+}
+
+int main(int argc, char **argv)
+{
+  const char *fen = nullptr;
+  int profondeur = 0;
+  bool division = false;
+  unsigned long long maximum = 20000000ULL; // Limite de la suite : environ une seconde par position
+  Board plateau;
+
+  for (int i = 1; i < argc; i++)
+  {
+    if (!strcmp(argv[i], "--fen") && i + 1 < argc)
+    {
+      fen = argv[++i];
+    }
+    else if (!strcmp(argv[i], "--depth") && i + 1 < argc)
+    {
+      profondeur = atoi(argv[++i]);
+    }
+    else if (!strcmp(argv[i], "--max") && i + 1 < argc)
+    {
+      maximum = strtoull(argv[++i], nullptr, 10);
+    }
+    else if (!strcmp(argv[i], "--divide"))
+    {
+      division = true;
+    }
+    else if (!strcmp(argv[i], "--suite"))
+    {
+      fen = nullptr;
+    }
+    else
+    {
+      fprintf(stderr, "Utilisation : %s [--suite] [--max N] [--fen \"<FEN>\"] [--depth N] [--divide]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  if (fen == nullptr)
+  {
+    return suite(maximum) ? 1 : 0;
+  }
+
+  if (!lireFen(plateau, fen))
+  {
+    fprintf(stderr, "FEN invalide : %s\n", fen);
+    return 2;
+  }
+  if (profondeur < 1)
+  {
+    profondeur = 1;
+  }
+
+  if (division)
+  {
+    auto debut = std::chrono::steady_clock::now();
+    unsigned long long noeuds = diviser(plateau, profondeur);
+    double duree = secondes(debut);
+
+    printf("Temps : %.3f s (%.0f noeuds/s)\n", duree, duree > 0 ? noeuds / duree : 0.0);
+    return 0;
+  }
+
+  mesurer(plateau, profondeur, nullptr, 0);
+  return 0;
+}
@@ -0,0 +1,418 @@
+/*
+simulation.cpp - Partie complete du micrologiciel sur un ordinateur Linux
+La meme logique que sur l'ESP32 (Echec_v1/Partie.h) roule avec la politique MaterielHote :
+la tache de lecture balaie une matrice d'interrupteurs reed simulee et le temps est virtuel.
+Un fil d'execution joue le role des joueurs : il leve et pose les pieces de chaque coup sur la matrice,
+puis appuie sur les deux boutons pendant le dernier coup pour terminer la partie, sauf si ce coup mate ou pat.
+Avec --moteur, le Moteur joue les deux camps et les joueurs ne font que deplacer les pieces qu'il indique.
+A la fin, la position du jeu est comparee a celle des coups rejoues sur un Board.
+
+Utilisation :
+  simulation --coups "e2e4 e7e5 g1f3"      Joue les coups, en notation FEN (voir perft --divide)
+  simulation --moteur N                    Joue N coups proposes par le Moteur, pour les deux camps
+             [--budget MS]                 Temps virtuel de recherche par coup (BUDGET_MOTEUR_MS par defaut)
+             [--profondeur N]              Recherche a N demi-coups, sans limite de temps sauf --budget : la partie
+                                           ne depend plus de la charge de l'ordinateur
+             [--attendu "<FEN>"]           Position finale attendue. Par defaut, celle des coups rejoues
+             [--acceleration N]            Le temps virtuel avance N fois plus vite que le temps reel (50 par defaut)
+             [--pause MS]                  Temps virtuel entre deux gestes des joueurs (1500 ms par defaut)
+             [--rebonds N]                 L'interrupteur de chaque case rebondit N fois (1 ms chacun) avant chaque geste
+             [--depart "<FEN>"]            Position de depart, importee par la commande "fen" du port serie
+             [--commande "pgn"]            Commande tapee sur le port serie a la fin de la partie
+*/
+
+#include <Materiel.h>
+#include <Partie.h>
+#include <Fen.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+static Partie<MaterielHote> partie; // La partie, comme dans Echec_v1.ino
+static uint32_t rebonds = 0;        // Rebonds de l'interrupteur reed a chaque geste
+static uint32_t gestesManques = 0;  // Gestes que la tache de lecture n'avait pas vus apres la pause
+static std::atomic<bool> finie(false); // La partie est terminee : les joueurs n'attendent plus de coup du Moteur
+
+// Structure. Un coup a jouer et le coup legal qui lui correspond
+struct CoupSimule
+{
+  char nom[6];
+  Coup coup;
+};
+
+// Lit un coup en notation FEN (ex : e2e4, e7e8q) et retourne le coup legal correspondant, ou COUP_NUL
+static Coup lireCoup(const Board &plateau, const char *nom)
+{
+  const char promotions[] = "nbrq";
+  Coup coups[MAX_COUPS];
+  int nombre = plateau.genererCoups(plateau.getTrait(), coups);
+  short depart, arrivee;
+
+  if (strlen(nom) < 4 || colonneFen(nom[0]) < 0 || colonneFen(nom[2]) < 0)
+  {
+    return COUP_NUL;
+  }
+  depart = numeroCase(nom[1] - '1', colonneFen(nom[0]));
+  arrivee = numeroCase(nom[3] - '1', colonneFen(nom[2]));
+
+  for (int i = 0; i < nombre; i++)
+  {
+    if (departCoup(coups[i]) != depart || arriveeCoup(coups[i]) != arrivee)
+    {
+      continue;
+    }
+    if (!estPromotion(coups[i]))
+    {
+      return coups[i];
+    }
+    // Le jeu ne promeut qu'en reine pour l'instant
+    if ((nom[4] == '\0' || nom[4] == 'q') && promotions[promotionCoup(coups[i]) - CAVALIER] == 'q')
+    {
+      return coups[i];
+    }
+  }
+  return COUP_NUL;
+}
+
+// Pose ou leve une piece, puis laisse le temps au jeu de voir le changement
+// Apres la pause, l'instantane du jeu doit montrer la matrice d'interrupteurs
+// Avant le geste, la case passe 'rebonds' fois au nouvel etat pendant 1 ms, comme un interrupteur reed qui rebondit
+static void geste(short position, bool poser, uint32_t pause)
+{
+  for (uint32_t i = 0; i < rebonds; i++)
+  {
+    uint64_t occupation = SimulateurHote::occupation();
+
+    SimulateurHote::setOccupation(occupation ^ (1ULL << position));
+    HorlogeHote::attendreMicros(1000);
+    SimulateurHote::setOccupation(occupation);
+    HorlogeHote::attendreMicros(1000);
+  }
+
+  if (poser)
+  {
+    SimulateurHote::poser(position);
+  }
+  else
+  {
+    SimulateurHote::lever(position);
+  }
+  HorlogeHote::attendre(pause);
+
+  if (partie.getTableauCourant() != SimulateurHote::occupation())
+  {
+    printf("Geste manque en %d\n", position);
+    gestesManques++;
+  }
+}
+
+// Deplace les pieces d'un coup sur la matrice d'interrupteurs
+// Dernier coup : les deux boutons sont appuyes avant le dernier geste, ce qui termine la partie a la fin du coup
+static void jouerCoup(Coup coup, bool dernier, uint32_t pause)
+{
+  short depart = departCoup(coup);
+  short arrivee = arriveeCoup(coup);
+
+  geste(depart, false, pause);
+  if (drapeauxCoup(coup) == COUP_EN_PASSANT)
+  {
+    geste(numeroCase(depart / TAILLE, arrivee % TAILLE), false, pause);
+  }
+  else if (estCapture(coup))
+  {
+    geste(arrivee, false, pause);
+  }
+
+  if (dernier && !estRoque(coup) && !estPromotion(coup))
+  {
+    SimulateurHote::forcer(CONFIRME, HIGH);
+    SimulateurHote::forcer(CHANGER, HIGH);
+  }
+  geste(arrivee, true, pause);
+
+  // Le jeu demande ensuite de deplacer la tour, ou d'echanger le pion contre une reine
+  if (estRoque(coup))
+  {
+    short tourDepart, tourArrivee;
+
+    Board::tourRoque(coup, tourDepart, tourArrivee);
+    geste(tourDepart, false, pause);
+    if (dernier)
+    {
+      SimulateurHote::forcer(CONFIRME, HIGH);
+      SimulateurHote::forcer(CHANGER, HIGH);
+    }
+    geste(tourArrivee, true, pause);
+  }
+  else if (estPromotion(coup))
+  {
+    geste(arrivee, false, pause);
+    if (dernier)
+    {
+      SimulateurHote::forcer(CONFIRME, HIGH);
+      SimulateurHote::forcer(CHANGER, HIGH);
+    }
+    geste(arrivee, true, pause);
+  }
+}
+
+// Les joueurs : deplacent les pieces de chaque coup de la liste
+// boutons : appuyer sur les deux boutons au dernier coup. Faux si ce coup mate ou pat : le jeu termine seul la partie
+static void joueurs(const std::vector<CoupSimule> &coups, bool boutons, uint32_t pause)
+{
+  HorlogeHote::attendre(pause);
+
+  for (size_t i = 0; i < coups.size(); i++)
+  {
+    printf("Joueurs : %s\n", coups[i].nom);
+    jouerCoup(coups[i].coup, boutons && i + 1 == coups.size(), pause);
+  }
+}
+
+// Les joueurs suivent le Moteur : ils attendent chaque coup propose et le jouent, 'nombre' fois
+// Les coups joues sont ajoutes a 'coups'. Un mat ou un pat avant la fin termine la partie sans eux
+static void joueursMoteur(std::vector<CoupSimule> &coups, size_t nombre, uint32_t pause)
+{
+  while (coups.size() < nombre)
+  {
+    CoupSimule simule = {};
+
+    while ((simule.coup = partie.coupPropose()) == COUP_NUL)
+    {
+      if (finie)
+      {
+        return;
+      }
+      HorlogeHote::attendre(10);
+    }
+    snprintf(simule.nom, sizeof(simule.nom), "%c%d%c%d", lettreFen(departCoup(simule.coup) % TAILLE), departCoup(simule.coup) / TAILLE + 1,
+             lettreFen(arriveeCoup(simule.coup) % TAILLE), arriveeCoup(simule.coup) / TAILLE + 1);
+    coups.push_back(simule);
+
+    printf("Joueurs : %s\n", simule.nom);
+    jouerCoup(simule.coup, coups.size() == nombre, pause);
+
+    // Le jeu retire la proposition quand il a vu le coup
+    while (partie.coupPropose() == simule.coup && !finie)
+    {
+      HorlogeHote::attendre(10);
+    }
+  }
+}
+
+// Ecrit la FEN d'une position sans les compteurs de coups
+static void fenSansCompteurs(const Board &plateau, char *fen, int taille)
+{
+  int espaces = 0;
+
+  ecrireFen(plateau, fen, taille);
+  for (char *c = fen; *c; c++)
+  {
+    if (*c == ' ' && ++espaces == 4)
+    {
+      *c = '\0';
+      break;
+    }
+  }
+}
+
+int main(int argc, char **argv)
+{
+  const char *liste = nullptr;
+  const char *attendu = nullptr;
+  uint32_t acceleration = 50;
+  uint32_t pause = 1500;
+  const char *commande = nullptr;
+  const char *depart = nullptr;
+  size_t coupsMoteur = 0;
+  uint32_t budget = BUDGET_MOTEUR_MS;
+  bool budgetDonne = false;
+  uint32_t profondeur = 0;
+  char moteur[48];
+  std::vector<CoupSimule> coups;
+  Board placee; // Position de depart, sur l'echiquier a la mise sous tension
+  Board suivi;  // Position des coups rejoues, pour valider les coups et connaitre la position attendue
+  char fenAttendue[TAILLE_FEN];
+  char fenObtenue[TAILLE_FEN];
+
+  for (int i = 1; i < argc; i++)
+  {
+    if (!strcmp(argv[i], "--coups") && i + 1 < argc)
+    {
+      liste = argv[++i];
+    }
+    else if (!strcmp(argv[i], "--attendu") && i + 1 < argc)
+    {
+      attendu = argv[++i];
+    }
+    else if (!strcmp(argv[i], "--acceleration") && i + 1 < argc)
+    {
+      acceleration = strtoul(argv[++i], nullptr, 10);
+    }
+    else if (!strcmp(argv[i], "--pause") && i + 1 < argc)
+    {
+      pause = strtoul(argv[++i], nullptr, 10);
+    }
+    else if (!strcmp(argv[i], "--rebonds") && i + 1 < argc)
+    {
+      rebonds = strtoul(argv[++i], nullptr, 10);
+    }
+    else if (!strcmp(argv[i], "--depart") && i + 1 < argc)
+    {
+      depart = argv[++i];
+    }
+    else if (!strcmp(argv[i], "--commande") && i + 1 < argc)
+    {
+      commande = argv[++i];
+    }
+    else if (!strcmp(argv[i], "--moteur") && i + 1 < argc)
+    {
+      coupsMoteur = strtoul(argv[++i], nullptr, 10);
+    }
+    else if (!strcmp(argv[i], "--budget") && i + 1 < argc)
+    {
+      budget = strtoul(argv[++i], nullptr, 10);
+      budgetDonne = true;
+    }
+    else if (!strcmp(argv[i], "--profondeur") && i + 1 < argc)
+    {
+      profondeur = strtoul(argv[++i], nullptr, 10);
+    }
+    else
+    {
+      fprintf(stderr, "Utilisation : %s --coups \"e2e4 e7e5 ...\" | --moteur N [--budget MS] [--profondeur N] [--attendu \"<FEN>\"] [--acceleration N] [--pause MS] [--rebonds N] [--depart \"<FEN>\"] [--commande TEXTE]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  // Valide tous les coups avant de commencer : un coup illegal bloquerait le jeu en attente d'une piece
+  if (!lireFen(placee, depart ? depart : FEN_DEPART))
+  {
+    fprintf(stderr, "FEN invalide : %s\n", depart);
+    return 2;
+  }
+  suivi = placee;
+  for (const char *c = liste; c && *c;)
+  {
+    CoupSimule simule = {};
+    int longueur = 0;
+
+    while (*c == ' ')
+    {
+      c++;
+    }
+    while (c[longueur] && c[longueur] != ' ')
+    {
+      longueur++;
+    }
+    if (longueur == 0)
+    {
+      break;
+    }
+
+    strncpy(simule.nom, c, (longueur < 5) ? longueur : 5);
+    simule.coup = lireCoup(suivi, simule.nom);
+    if (simule.coup == COUP_NUL)
+    {
+      fprintf(stderr, "Coup illegal : %s\n", simule.nom);
+      return 2;
+    }
+    suivi.jouer(simule.coup);
+    coups.push_back(simule);
+    c += longueur;
+  }
+  if (coups.empty() == (coupsMoteur == 0))
+  {
+    fprintf(stderr, "Donner soit --coups, soit --moteur\n");
+    return 2;
+  }
+
+  // Les pieces sont sur leurs cases de depart a la mise sous tension. Une autre position est importee
+  // sur le port serie, comme si elle avait ete tapee avant que les pieces soient placees
+  const uint8_t selection[4] = {MUX_S0, MUX_S1, MUX_S2, MUX_S3};
+  const uint8_t activation[4] = {MUX1_E, MUX2_E, MUX3_E, MUX4_E};
+
+  HorlogeHote::accelerer(acceleration);
+  SimulateurHote::brancherMultiplexeurs(selection, activation, RS_DATA);
+  SimulateurHote::setOccupation(placee.occupation());
+  if (depart)
+  {
+    ConsoleHote::injecter("fen ");
+    ConsoleHote::injecter(depart);
+    ConsoleHote::injecter("\n");
+  }
+  if (coupsMoteur)
+  {
+    // Avec une profondeur, le budget n'est une limite que s'il est donne
+    snprintf(moteur, sizeof(moteur), "moteur deux %u %u\n", (profondeur && !budgetDonne) ? 0 : budget, profondeur);
+    ConsoleHote::injecter(moteur);
+  }
+
+  partie.setup();
+  std::thread fil;
+  if (coupsMoteur)
+  {
+    fil = std::thread(joueursMoteur, std::ref(coups), coupsMoteur, pause);
+  }
+  else
+  {
+    Coup legaux[MAX_COUPS];
+
+    fil = std::thread(joueurs, std::cref(coups), suivi.genererCoups(suivi.getTrait(), legaux) != 0, pause);
+  }
+  partie.loop();
+
+  finie = true;
+  fil.join();
+  TachesHote::terminer();
+
+  // Les coups du Moteur ne sont connus qu'a la fin : ils sont rejoues ici
+  if (coupsMoteur)
+  {
+    for (const CoupSimule &simule : coups)
+    {
+      suivi.jouer(simule.coup);
+    }
+  }
+  if (attendu)
+  {
+    strncpy(fenAttendue, attendu, sizeof(fenAttendue) - 1);
+    fenAttendue[sizeof(fenAttendue) - 1] = '\0';
+  }
+  else
+  {
+    fenSansCompteurs(suivi, fenAttendue, sizeof(fenAttendue));
+  }
+
+  // La commande est lue par le jeu, comme entre deux lectures du tableau
+  if (commande)
+  {
+    ConsoleHote::injecter(commande);
+    ConsoleHote::injecter("\n");
+    partie.lireCommandes();
+  }
+
+  fenSansCompteurs(partie.getPlateau(), fenObtenue, sizeof(fenObtenue));
+  printf("\nCoups joues : %zu\nTemps virtuel : %.1f s\nBalayages par seconde : %u\nLectures reprises : %u\nImages DEL : %u\nPages OLED : %u\nPosition : %s\n",
+         coups.size(), HorlogeHote::millis() / 1000.0, partie.balayagesParSeconde(), partie.reprisesTableau(), partie.envoisDel(),
+         partie.pagesEcran(), fenObtenue);
+  if (coupsMoteur)
+  {
+    printf("Noeuds par seconde : %u\n", partie.noeudsParSeconde());
+  }
+  if (strncmp(fenObtenue, fenAttendue, strlen(fenAttendue)))
+  {
+    printf("ERREUR : position attendue %s\n", fenAttendue);
+    return 1;
+  }
+  if (gestesManques)
+  {
+    printf("ERREUR : %u gestes manques\n", gestesManques);
+    return 1;
+  }
+  printf("OK\n");
+  return 0;
+}